@@ -0,0 +1,102 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include <pmacc/dataManagement/ISimulationData.hpp>
+#include <pmacc/memory/buffers/GridBuffer.hpp>
+#include <pmacc/memory/buffers/gridBuffer/ExchangeAggregator.hpp>
+
+#include <cstdint>
+#include <string>
+
+
+namespace picongpu
+{
+
+    /** Guard exchange of several fields with one message per neighbor
+     *
+     * Registered at the DataConnector, so that all stages which exchange
+     * the same set of fields share the host message buffers and the
+     * communication tag of the aggregator.
+     */
+    class AggregatedExchange : public ISimulationData
+    {
+    public:
+
+        /** Create an exchange without fields
+         *
+         * @param name unique id in the DataConnector
+         * @param communicationTag unique tag of the aggregated messages
+         */
+        AggregatedExchange(
+            std::string const & name,
+            uint32_t const communicationTag
+        ) :
+            name( name ),
+            aggregator( communicationTag )
+        {
+        }
+
+        /** Add all exchanges of a field
+         *
+         * All ranks must add the same buffers in the same order.
+         *
+         * @param gridBuffer host-device buffer of the field
+         */
+        template< typename T_Item, typename T_BorderItem >
+        void add( pmacc::mem::GridBuffer< T_Item, simDim, T_BorderItem > & gridBuffer )
+        {
+            aggregator.add( gridBuffer );
+        }
+
+        //! Exchange the guards of all added fields
+        void communication( )
+        {
+            aggregator.communication( );
+        }
+
+        //! Id of the exchange of FieldE and FieldB
+        static std::string getNameEB( )
+        {
+            return "FieldEB";
+        }
+
+        //! Nothing to synchronize, the exchange holds no field data
+        void synchronize( ) override
+        {
+        }
+
+        SimulationDataId getUniqueId( ) override
+        {
+            return name;
+        }
+
+    private:
+
+        //! id in the DataConnector
+        std::string name;
+
+        pmacc::mem::ExchangeAggregator< simDim > aggregator;
+
+    };
+
+} // namespace picongpu
@@ -104,6 +104,12 @@ namespace fields
          */
         HINLINE void reset( uint32_t currentStep ) override;
 
+        /** Reset the device buffer for field values
+         *
+         * @param currentStep index of time iteration
+         */
+        HINLINE void resetDevice( uint32_t currentStep ) override;
+
         //! Synchronize device data with host data
         HINLINE void syncToDevice( ) override;
 
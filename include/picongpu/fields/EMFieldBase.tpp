@@ -149,6 +149,11 @@ namespace fields
         pmacc::mem::buffer::reset( buffer->device(), false );
     }
 
+    void EMFieldBase::resetDevice( uint32_t )
+    {
+        pmacc::mem::buffer::reset( buffer->device(), false );
+    }
+
     void EMFieldBase::syncToDevice( )
     {
         pmacc::mem::buffer::copy( device().write(), host().read() );
@@ -22,6 +22,7 @@
 
 #include "picongpu/simulation_defines.hpp"
 #include "picongpu/fields/Fields.def"
+#include "picongpu/fields/AggregatedExchange.hpp"
 
 #include <pmacc/fields/SimulationFieldHelper.hpp>
 #include <pmacc/dataManagement/ISimulationData.hpp>
@@ -145,6 +146,24 @@ namespace picongpu
          */
         HINLINE void communicationGather( );
 
+        /** Start asynchronous send of the field values of several fields
+         *
+         * Same as communication() of each field, but the values of all
+         * fields for a neighbor are sent in one message.
+         *
+         * @param fields temporary fields, in the same order on all ranks
+         */
+        HINLINE static void communication( std::vector< std::shared_ptr< FieldTmp > > const & fields );
+
+        /** Gather data of several fields from neighboring GPUs
+         *
+         * Same as communicationGather() of each field, but the values of all
+         * fields from a neighbor are received in one message.
+         *
+         * @param fields temporary fields, in the same order on all ranks
+         */
+        HINLINE static void communicationGather( std::vector< std::shared_ptr< FieldTmp > > const & fields );
+
         /** Compute current density created by a species in an area
          *
          * @tparam T_area area to compute currents in
@@ -174,6 +193,19 @@ namespace picongpu
 
     private:
 
+        /** Get the shared exchange of several fields
+         *
+         * The exchange is created and registered at the DataConnector with
+         * the first call for a set of fields.
+         *
+         * @param fields temporary fields
+         * @param gather exchange of communicationGather() instead of communication()
+         */
+        HINLINE static std::shared_ptr< AggregatedExchange > getAggregatedExchange(
+            std::vector< std::shared_ptr< FieldTmp > > const & fields,
+            bool gather
+        );
+
         //! Host-device buffer for current density values
         std::unique_ptr< pmacc::mem::GridBuffer<ValueType, simDim> > fieldTmp;
 
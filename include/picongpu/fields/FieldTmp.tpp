@@ -289,6 +289,62 @@ namespace picongpu
             fieldTmpRecv->communication( );
     }
 
+    void FieldTmp::communication( std::vector< std::shared_ptr< FieldTmp > > const & fields )
+    {
+        auto exchange = getAggregatedExchange( fields, false );
+
+        for( auto & field : fields )
+            for( uint32_t i = 1; i < pmacc::traits::NumberOfExchanges<simDim>::value; ++i )
+                if( field->fieldTmp->hasSendExchange( i ) )
+                    field->bashField( i );
+
+        exchange->communication( );
+
+        for( auto & field : fields )
+            for( uint32_t i = 1; i < pmacc::traits::NumberOfExchanges<simDim>::value; ++i )
+                if( field->fieldTmp->hasReceiveExchange( i ) )
+                    field->insertField( i );
+    }
+
+    void FieldTmp::communicationGather( std::vector< std::shared_ptr< FieldTmp > > const & fields )
+    {
+        PMACC_VERIFY_MSG(
+            fieldTmpSupportGatherCommunication == true,
+            "fieldTmpSupportGatherCommunication in memory.param must be set to true"
+        );
+
+        getAggregatedExchange( fields, true )->communication( );
+    }
+
+    std::shared_ptr< AggregatedExchange > FieldTmp::getAggregatedExchange(
+        std::vector< std::shared_ptr< FieldTmp > > const & fields,
+        bool const gather
+    )
+    {
+        std::string name = gather ? "FieldTmpGather" : "FieldTmpScatter";
+        for( auto const & field : fields )
+            name += "_" + std::to_string( field->m_slotId );
+
+        DataConnector & dc = Environment<>::get().DataConnector();
+        if( ! dc.hasId( name ) )
+        {
+            /* all ranks exchange the same sets of fields in the same order,
+             * so the tags are the same on all ranks
+             */
+            auto exchange = std::make_unique< AggregatedExchange >(
+                name,
+                pmacc::traits::getNextId( ) + SPECIES_FIRSTTAG
+            );
+            for( auto & field : fields )
+                exchange->add( gather ? *field->fieldTmpRecv : *field->fieldTmp );
+            dc.consume( std::move( exchange ) );
+        }
+
+        auto exchange = dc.get< AggregatedExchange >( name, true );
+        dc.releaseData( name );
+        return exchange;
+    }
+
     void FieldTmp::bashField( uint32_t exchangeType )
     {
         Environment<>::task(
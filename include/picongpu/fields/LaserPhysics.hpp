@@ -110,7 +110,13 @@ namespace fields
     /** Laser init in a single xz plane */
     struct LaserPhysics
     {
-        void operator()(uint32_t currentStep) const
+        /** check if the laser modifies the electric field in a time step
+         *
+         * The result is the same on all ranks.
+         *
+         * @param currentStep current time step
+         */
+        static bool isActive(uint32_t currentStep)
         {
             /* The laser can be initialized in the plane of the first cell or
              * any later x-z plane inside the simulation. Initializing the
@@ -138,7 +144,12 @@ namespace fields
                 laserInitTimeOver ||
                 topBoundariesArePeriodic ||
                 boxHasSlided;
-            if( !disableLaser )
+            return !disableLaser;
+        }
+
+        void operator()(uint32_t currentStep) const
+        {
+            if( isActive( currentStep ) )
             {
                 PMACC_VERIFY_MSG(
                     laserProfiles::Selected::Unitless::initPlaneY < static_cast<uint32_t>( Environment<simDim>::get().SubGrid().getLocalDomain().size.y() ),
@@ -0,0 +1,52 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+
+namespace picongpu
+{
+namespace fields
+{
+namespace maxwellSolver
+{
+
+    /** update of the CORE by one task per patch (runtime option --patches)
+     *
+     * A solver which supports patches launches one task per CORE patch
+     * (see pmacc::PatchMapping), which declares only the patches it writes
+     * and reads.
+     *
+     * The default is a solver which updates the CORE by one task and
+     * ignores the patches.
+     *
+     * @tparam T_Solver field solver type
+     */
+    template< typename T_Solver >
+    struct Patches
+    {
+        //! true if the solver splits the CORE update into patches
+        static constexpr bool supported = false;
+    };
+
+} // namespace maxwellSolver
+} // namespace fields
+} // namespace picongpu
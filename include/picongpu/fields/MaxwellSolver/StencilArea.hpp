@@ -0,0 +1,86 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+#include "picongpu/traits/GetMargin.hpp"
+
+#include <pmacc/math/Vector.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+
+namespace picongpu
+{
+namespace fields
+{
+namespace maxwellSolver
+{
+
+    /** areas of a field which are read by a stencil update
+     *
+     * The stencil margin of a field solver is at most one supercell (see
+     * StencilFitsSuperCell), so an update of the CORE reads the BORDER and an
+     * update of the BORDER reads the GUARD. Declaring only these areas as
+     * task accesses allows a CORE update to run while the guards are
+     * exchanged.
+     *
+     * @tparam T_area area which is updated (CORE, BORDER or CORE + BORDER)
+     */
+    template< uint32_t T_area >
+    struct StencilReadArea
+    {
+        static constexpr uint32_t value =
+            ( T_area & BORDER ) ? CORE + BORDER + GUARD : CORE + BORDER;
+    };
+
+    /** check if a stencil reads at most one supercell beyond the updated cells
+     *
+     * StencilReadArea and pmacc::PatchMapping::getStencilMask() rely on it,
+     * solvers using them must assert it.
+     *
+     * @tparam T_Curl curl functor, provides the lower and upper margin in cells
+     */
+    template< typename T_Curl >
+    struct StencilFitsSuperCell
+    {
+        /* a margin is within a supercell if the component-wise maximum of
+         * both is the supercell size
+         */
+        template< typename T_Margin >
+        using FitsSuperCell = std::integral_constant<
+            bool,
+            pmacc::math::CT::volume<
+                typename pmacc::math::CT::max<
+                    T_Margin,
+                    SuperCellSize
+                >::type
+            >::type::value == pmacc::math::CT::volume< SuperCellSize >::type::value
+        >;
+
+        static constexpr bool value =
+            FitsSuperCell< typename traits::GetLowerMargin< T_Curl >::type >::value &&
+            FitsSuperCell< typename traits::GetUpperMargin< T_Curl >::type >::value;
+    };
+
+} // namespace maxwellSolver
+} // namespace fields
+} // namespace picongpu
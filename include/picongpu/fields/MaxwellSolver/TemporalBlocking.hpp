@@ -0,0 +1,71 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include <cstdint>
+
+
+namespace picongpu
+{
+namespace fields
+{
+namespace maxwellSolver
+{
+
+    /** advance a field solver by several steps with one exchange of the guards
+     *
+     * Within a temporal block the solver updates the fields redundantly in
+     * the inner GUARD layers instead of exchanging the guards every half
+     * step. The caller must ensure that the fields are not modified by
+     * anything else than the solver and the current of the local particles
+     * near the domain boundaries during a block.
+     *
+     * The default is a solver without temporal blocking.
+     *
+     * @tparam T_Solver field solver type
+     */
+    template< typename T_Solver >
+    struct TemporalBlocking
+    {
+        //! maximum number of steps between two guard exchanges
+        static constexpr uint32_t maxSteps = 1u;
+
+        //! true if the solver is within a temporal block
+        static bool isInBlock( T_Solver const & )
+        {
+            return false;
+        }
+
+        /** start a temporal block with the next step
+         *
+         * The guards are exchanged at the end of the last step of the block.
+         *
+         * @param numSteps number of steps of the block, in [1;maxSteps]
+         */
+        static void begin( T_Solver &, uint32_t const )
+        {
+        }
+    };
+
+} // namespace maxwellSolver
+} // namespace fields
+} // namespace picongpu
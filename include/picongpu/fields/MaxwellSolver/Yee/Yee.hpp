@@ -23,18 +23,30 @@
 #include "picongpu/simulation_defines.hpp"
 #include "picongpu/fields/MaxwellSolver/Yee/Yee.def"
 #include "picongpu/fields/absorber/ExponentialDamping.hpp"
+#include "picongpu/fields/AggregatedExchange.hpp"
 #include "picongpu/fields/FieldE.hpp"
 #include "picongpu/fields/FieldB.hpp"
 #include "picongpu/fields/MaxwellSolver/Yee/Yee.kernel"
+#include "picongpu/fields/MaxwellSolver/Patches.hpp"
+#include "picongpu/fields/MaxwellSolver/StencilArea.hpp"
+#include "picongpu/fields/MaxwellSolver/TemporalBlocking.hpp"
 #include "picongpu/fields/cellType/Yee.hpp"
 #include "picongpu/fields/LaserPhysics.hpp"
 #include "picongpu/fields/differentiation/Curl.hpp"
 #include "picongpu/traits/GetMargin.hpp"
 
 #include <pmacc/nvidia/functors/Assign.hpp>
+#include <pmacc/mappings/kernel/AreaMapping.hpp>
+#include <pmacc/mappings/kernel/InnerGuardMapping.hpp>
+#include <pmacc/mappings/kernel/PatchMapping.hpp>
 #include <pmacc/mappings/threads/ThreadCollective.hpp>
 #include <pmacc/memory/boxes/CachedBox.hpp>
 #include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/memory/dataTypes/Mask.hpp>
+#include <pmacc/traits/NumberOfExchanges.hpp>
+#include <pmacc/verify.hpp>
+
+#include <algorithm>
 
 
 namespace picongpu
@@ -54,24 +66,61 @@ namespace maxwellSolver
     private:
         typedef MappingDesc::SuperCellSize SuperCellSize;
 
+        PMACC_CASSERT_MSG(
+            Stencil_margin_of_the_field_solver_must_be_at_most_one_supercell____check_SuperCellSize,
+            StencilFitsSuperCell< CurlE >::value && StencilFitsSuperCell< CurlB >::value
+        );
+
 
         std::shared_ptr< FieldE > fieldE;
         std::shared_ptr< FieldB > fieldB;
         MappingDesc m_cellDescription;
 
-        template<uint32_t AREA>
-        void updateE()
+        //! steps left in the current temporal block, 0 outside of a block
+        uint32_t remainingBlockSteps = 0u;
+
+        /** area updated within a temporal block
+         *
+         * CORE + BORDER and all but the outermost GUARD supercell layer on
+         * each side with a neighbor. Sides without a neighbor keep their
+         * GUARD as the boundary condition, as in a step without blocking.
+         */
+        InnerGuardMapping< MappingDesc > getBlockMapping() const
         {
-            /* Courant-Friedrichs-Levy-Condition for Yee Field Solver:
-             *
-             * A workaround is to add a template dependency to the expression.
-             * `sizeof(ANY_TYPE*) != 0` is always true and defers the evaluation.
-             */
-            PMACC_CASSERT_MSG(Courant_Friedrichs_Levy_condition_failure____check_your_grid_param_file,
-                (SPEED_OF_LIGHT*SPEED_OF_LIGHT*DELTA_T*DELTA_T*INV_CELL2_SUM)<=1.0 && sizeof(T_CurrentInterpolation*) != 0);
+            DataSpace< simDim > const guardingSuperCells = m_cellDescription.getGuardingSuperCells();
+            DataSpace< simDim > lowerLayers;
+            DataSpace< simDim > upperLayers;
+            Mask const communicationMask = Environment< simDim >::get().GridController().getCommunicationMask();
+            for( uint32_t i = 1; i < NumberOfExchanges< simDim >::value; ++i )
+            {
+                /* only planes: left right top bottom back front */
+                if( FRONT % i != 0 || !communicationMask.isSet( i ) )
+                    continue;
+                DataSpace< simDim > const relDir = Mask::getRelativeDirections< simDim >( i );
+                for( uint32_t d = 0; d < simDim; ++d )
+                {
+                    if( relDir[ d ] < 0 )
+                        lowerLayers[ d ] = guardingSuperCells[ d ] - 1;
+                    if( relDir[ d ] > 0 )
+                        upperLayers[ d ] = guardingSuperCells[ d ] - 1;
+                }
+            }
+            return InnerGuardMapping< MappingDesc >( m_cellDescription, lowerLayers, upperLayers );
+        }
+
+        /** update E in the area of a mapper
+         *
+         * @param mapper AreaMapping or PatchMapping of the updated area
+         * @param patches CORE patches which are written
+         * @param stencilPatches CORE patches which are read by the stencil
+         */
+        template<typename T_Mapper>
+        void updateE(T_Mapper const mapper, uint64_t const patches, uint64_t const stencilPatches)
+        {
+            constexpr uint32_t AREA = T_Mapper::AreaType;
 
             Environment<>::task(
-                [cellDescription = m_cellDescription](
+                [mapper](
                     auto fieldEDeviceData,
                     auto fieldBDeviceData
                 )
@@ -82,8 +131,6 @@ namespace maxwellSolver
                         typename traits::GetUpperMargin<CurlB>::type
                     > BlockArea;
 
-                    AreaMapping<AREA, MappingDesc> mapper(cellDescription);
-
                     constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
                         pmacc::math::CT::volume< SuperCellSize >::type::value
                     >::value;
@@ -101,16 +148,26 @@ namespace maxwellSolver
                     .label("Yee::updateE()")
                     .scheduling_tags({ SCHED_CUPLA }),
 
-                fieldE->device().data(),
-                fieldB->device().data()
+                fieldE->device().data().access_dataPlace( AREA ).access_patches( patches ),
+                fieldB->device().data().read()
+                    .access_dataPlace( StencilReadArea< AREA >::value )
+                    .access_patches( stencilPatches )
             );
         }
 
-        template<uint32_t AREA>
-        void updateBHalf()
+        /** update B by a half step in the area of a mapper
+         *
+         * @param mapper AreaMapping or PatchMapping of the updated area
+         * @param patches CORE patches which are written
+         * @param stencilPatches CORE patches which are read by the stencil
+         */
+        template<typename T_Mapper>
+        void updateBHalf(T_Mapper const mapper, uint64_t const patches, uint64_t const stencilPatches)
         {
+            constexpr uint32_t AREA = T_Mapper::AreaType;
+
             Environment<>::task(
-                [cellDescription = m_cellDescription](
+                [mapper](
                     auto fieldEDeviceData,
                     auto fieldBDeviceData
                 )
@@ -121,8 +178,6 @@ namespace maxwellSolver
                         typename CurlE::UpperMargin
                     > BlockArea;
 
-                    AreaMapping<AREA, MappingDesc> mapper(cellDescription);
-
                     constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
                         pmacc::math::CT::volume< SuperCellSize >::type::value
                     >::value;
@@ -139,16 +194,93 @@ namespace maxwellSolver
                     .label("Yee::updateBHalf()")
                     .scheduling_tags({ SCHED_CUPLA }),
 
-                fieldE->device().data(),
-                fieldB->device().data()                
+                fieldE->device().data().read()
+                    .access_dataPlace( StencilReadArea< AREA >::value )
+                    .access_patches( stencilPatches ),
+                fieldB->device().data().access_dataPlace( AREA ).access_patches( patches )
             );
         }
 
+        /* The CORE is updated by one task per patch (see PatchMapping),
+         * a patch only waits for the updates of its neighboring patches.
+         */
+        template<uint32_t AREA>
+        void updateE()
+        {
+            /* Courant-Friedrichs-Levy-Condition for Yee Field Solver:
+             *
+             * A workaround is to add a template dependency to the expression.
+             * `sizeof(ANY_TYPE*) != 0` is always true and defers the evaluation.
+             */
+            PMACC_CASSERT_MSG(Courant_Friedrichs_Levy_condition_failure____check_your_grid_param_file,
+                (SPEED_OF_LIGHT*SPEED_OF_LIGHT*DELTA_T*DELTA_T*INV_CELL2_SUM)<=1.0 && sizeof(T_CurrentInterpolation*) != 0);
+
+            if( AREA == CORE )
+                for( uint32_t patch = 0; patch < m_cellDescription.getNumPatches(); ++patch )
+                {
+                    PatchMapping< MappingDesc > mapper( m_cellDescription, patch );
+                    updateE( mapper, mapper.getPatchMask( patch ), mapper.getStencilMask( patch ) );
+                }
+            else
+                updateE( AreaMapping< AREA, MappingDesc >( m_cellDescription ), ~0ull, ~0ull );
+        }
+
+        template<uint32_t AREA>
+        void updateBHalf()
+        {
+            if( AREA == CORE )
+                for( uint32_t patch = 0; patch < m_cellDescription.getNumPatches(); ++patch )
+                {
+                    PatchMapping< MappingDesc > mapper( m_cellDescription, patch );
+                    updateBHalf( mapper, mapper.getPatchMask( patch ), mapper.getStencilMask( patch ) );
+                }
+            else
+                updateBHalf( AreaMapping< AREA, MappingDesc >( m_cellDescription ), ~0ull, ~0ull );
+        }
+
     public:
 
         using CellType = cellType::Yee;
         using CurrentInterpolation = T_CurrentInterpolation;
 
+        /** maximum number of steps of a temporal block
+         *
+         * Each update invalidates the cells within its stencil margin at the
+         * boundary of the updated area, a step updates B twice and E once.
+         * The current of the particles of a neighbor which enter its BORDER
+         * during a block spreads by at most one more cell per step.
+         * The inner GUARD layers must cover all these cells.
+         * The particles move at most one cell per step and their current
+         * reaches at most three cells further. The BORDER is checked to be
+         * free of particles one block before a block starts (see
+         * simulation::stage::FieldTemporalBlocking), so no current is
+         * deposited in the GUARD during a block of up to
+         * (SuperCellSize - 4) / 2 steps.
+         */
+        static constexpr uint32_t maxBlockSteps = std::max(
+            1,
+            std::min(
+                ( int( pmacc::math::CT::min< SuperCellSize >::type::value ) - 4 ) / 2,
+                (
+                    pmacc::math::CT::min<
+                        typename pmacc::math::CT::mul< GuardSize, SuperCellSize >::type
+                    >::type::value -
+                    pmacc::math::CT::max< SuperCellSize >::type::value
+                ) / (
+                    3 * std::max(
+                        std::max(
+                            int( pmacc::math::CT::max< typename CurlE::LowerMargin >::type::value ),
+                            int( pmacc::math::CT::max< typename CurlE::UpperMargin >::type::value )
+                        ),
+                        std::max(
+                            int( pmacc::math::CT::max< typename CurlB::LowerMargin >::type::value ),
+                            int( pmacc::math::CT::max< typename CurlB::UpperMargin >::type::value )
+                        )
+                    ) + 1
+                )
+            )
+        );
+
         Yee(MappingDesc cellDescription) : m_cellDescription(cellDescription)
         {
             DataConnector &dc = Environment<>::get().DataConnector();
@@ -157,10 +289,45 @@ namespace maxwellSolver
             this->fieldB = dc.get< FieldB >( FieldB::getName(), true );
         }
 
+        //! true if the solver is within a temporal block
+        bool isInTemporalBlock() const
+        {
+            return remainingBlockSteps != 0u;
+        }
+
+        /** start a temporal block with the next step
+         *
+         * The next @p numSteps steps update the fields without exchanging the
+         * guards, which are exchanged once at the end of the last step.
+         *
+         * @param numSteps number of steps, in [1;maxBlockSteps]
+         */
+        void beginTemporalBlock(uint32_t const numSteps)
+        {
+            PMACC_VERIFY_MSG(
+                numSteps >= 1u && numSteps <= maxBlockSteps,
+                "the number of steps of a temporal block exceeds the GUARD of the field solver"
+            );
+            remainingBlockSteps = numSteps;
+        }
+
+        /* CORE and BORDER are updated by separate tasks which only declare
+         * the areas they touch, so the CORE updates overlap with the
+         * exchange of the guards.
+         */
         void update_beforeCurrent(uint32_t)
         {
-            updateBHalf < CORE+BORDER >();
+            if( isInTemporalBlock() )
+            {
+                auto const mapper = getBlockMapping();
+                updateBHalf( mapper, ~0ull, ~0ull );
+                updateE( mapper, ~0ull, ~0ull );
+                return;
+            }
+
+            updateBHalf < BORDER >();
             fieldB->communication();
+            updateBHalf < CORE >();
             updateE<CORE>();
             updateE<BORDER>();
         }
@@ -177,6 +344,26 @@ namespace maxwellSolver
             if (laserProfiles::Selected::INIT_TIME > float_X(0.0))
                 Environment<>::fun_task( LaserPhysics{}, currentStep );
 
+            if( isInTemporalBlock() )
+            {
+                updateBHalf( getBlockMapping(), ~0ull, ~0ull );
+
+                Absorber::run(
+                    currentStep,
+                    this->m_cellDescription,
+                    this->fieldB->device()
+                );
+
+                // E and B are both final at the end of a block, send them in one message
+                if( --remainingBlockSteps == 0u )
+                {
+                    DataConnector & dc = Environment<>::get().DataConnector();
+                    dc.get< AggregatedExchange >( AggregatedExchange::getNameEB(), true )->communication();
+                    dc.releaseData( AggregatedExchange::getNameEB() );
+                }
+                return;
+            }
+
             fieldE->communication();
 
             updateBHalf < CORE> ();
@@ -198,6 +385,54 @@ namespace maxwellSolver
         }
     };
 
+    template<
+        typename T_CurrentInterpolation,
+        class CurlE,
+        class CurlB
+    >
+    struct TemporalBlocking<
+        Yee<
+            T_CurrentInterpolation,
+            CurlE,
+            CurlB
+        >
+    >
+    {
+        using Solver = Yee<
+            T_CurrentInterpolation,
+            CurlE,
+            CurlB
+        >;
+
+        static constexpr uint32_t maxSteps = Solver::maxBlockSteps;
+
+        static bool isInBlock( Solver const & solver )
+        {
+            return solver.isInTemporalBlock();
+        }
+
+        static void begin( Solver & solver, uint32_t const numSteps )
+        {
+            solver.beginTemporalBlock( numSteps );
+        }
+    };
+
+    template<
+        typename T_CurrentInterpolation,
+        class CurlE,
+        class CurlB
+    >
+    struct Patches<
+        Yee<
+            T_CurrentInterpolation,
+            CurlE,
+            CurlB
+        >
+    >
+    {
+        static constexpr bool supported = true;
+    };
+
 } // namespace maxwellSolver
 } // namespace fields
 
@@ -316,6 +316,11 @@ namespace yeePML
         pmacc::mem::buffer::reset( data.device(), false );
     }
 
+    void Field::resetDevice( uint32_t )
+    {
+        pmacc::mem::buffer::reset( data.device(), false );
+    }
+
     void Field::syncToDevice( )
     {
         pmacc::mem::buffer::copy( data.device(), data.host() );
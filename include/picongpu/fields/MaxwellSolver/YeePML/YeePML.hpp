@@ -25,6 +25,7 @@
 #include "picongpu/fields/MaxwellSolver/YeePML/Field.hpp"
 #include "picongpu/fields/MaxwellSolver/YeePML/Parameters.hpp"
 #include "picongpu/fields/MaxwellSolver/YeePML/YeePML.kernel"
+#include "picongpu/fields/MaxwellSolver/StencilArea.hpp"
 #include "picongpu/fields/cellType/Yee.hpp"
 #include "picongpu/traits/GetMargin.hpp"
 
@@ -76,6 +77,11 @@ namespace maxwellSolver
             using CurlE = T_CurlE;
             using CurlB = T_CurlB;
 
+            PMACC_CASSERT_MSG(
+                Stencil_margin_of_the_field_solver_must_be_at_most_one_supercell____check_SuperCellSize,
+                StencilFitsSuperCell< CurlE >::value && StencilFitsSuperCell< CurlB >::value
+            );
+
             Solver( MappingDesc const cellDescription ) :
                 cellDescription{ cellDescription }
             {
@@ -141,9 +147,9 @@ namespace maxwellSolver
                     TaskProperties::Builder()
                         .label("YeePML::updateBHalf()")
                         .scheduling_tags({ SCHED_CUPLA }),
-                    fieldE->device().data(),
-                    fieldB->device().data(),
-                    psiE->device()
+                    fieldE->device().data().read().access_dataPlace( StencilReadArea< T_Area >::value ),
+                    fieldB->device().data().access_dataPlace( T_Area ),
+                    psiB->device()
                 );
             }
 
@@ -195,8 +201,8 @@ namespace maxwellSolver
                     TaskProperties::Builder()
                         .label("YeePML::updateE()")
                         .scheduling_tags({ SCHED_CUPLA }),
-                    fieldB->device().data(),
-                    fieldE->device().data(),
+                    fieldE->device().data().access_dataPlace( T_Area ),
+                    fieldB->device().data().read().access_dataPlace( StencilReadArea< T_Area >::value ),
                     psiE->device()
                 );
             }
@@ -443,8 +449,9 @@ namespace maxwellSolver
              * PML updates are done as part of solver.updateE( ),
              * solver.updateBHalf( )
              */
-            solver.template updateBHalf < CORE + BORDER >( currentStep );
+            solver.template updateBHalf < BORDER >( currentStep );
             solver.getFieldB( ).communication();
+            solver.template updateBHalf < CORE >( currentStep );
 
             solver.template updateE< CORE >( currentStep );
             solver.template updateE< BORDER >( currentStep );
@@ -70,6 +70,24 @@ private:
 };
 
 
+/** field functor for the pusher returning an already interpolated value
+ *
+ * Used to interpolate the fields of several particles in front of a
+ * vectorized push, the position argument is ignored.
+ */
+struct InterpolatedFieldForPusher
+{
+    float3_X value;
+
+    template< typename T_PosType >
+    HDINLINE
+    float3_X operator()( const T_PosType& ) const
+    {
+        return value;
+    }
+};
+
+
 /** functor to create particle field interpolator
  *
  * required to get interpolator for pusher
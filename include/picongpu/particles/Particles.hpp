@@ -28,6 +28,7 @@
 #include "picongpu/particles/manipulators/manipulators.def"
 
 #include <pmacc/memory/dataTypes/Mask.hpp>
+#include <pmacc/memory/FramePool.hpp>
 #include <pmacc/mappings/simulation/GridController.hpp>
 #include <pmacc/dataManagement/ISimulationData.hpp>
 #include <pmacc/particles/ParticleDescription.hpp>
@@ -50,18 +51,11 @@ namespace picongpu
 using namespace pmacc;
 
 #if(!BOOST_LANG_CUDA && !BOOST_COMP_HIP)
-/* dummy because we are not using mallocMC with cupla
- * DeviceHeap is defined in `mallocMC.param`
+/* we are not using mallocMC with the CPU accelerators of cupla,
+ * frames are allocated from a pool in host memory
+ * on GPUs DeviceHeap is defined in `mallocMC.param`
  */
-struct DeviceHeap
-{
-    using AllocatorHandle = int;
-
-    int getAllocatorHandle()
-    {
-        return 0;
-    }
-};
+using DeviceHeap = pmacc::memory::FramePool;
 #endif
 
 /** particle species
@@ -224,6 +218,30 @@ public:
 
 private:
 
+    /** submit the particle push for all supercells of an area
+     *
+     * @tparam T_Pusher non-composite pusher type
+     * @tparam T_area area of the pushed supercells (CORE or BORDER)
+     * @param currentStep current time iteration
+     * @param fieldEDevice guard to the electric field, restricted to the read area
+     * @param fieldBDevice guard to the magnetic field, restricted to the read area
+     * @param guardAccesses additional read accesses of the task (only declared,
+     *                      e.g. the GUARD parts of the fields)
+     */
+    template<
+        typename T_Pusher,
+        uint32_t T_area,
+        typename T_FieldEGuard,
+        typename T_FieldBGuard,
+        typename... T_GuardAccesses
+    >
+    void pushArea(
+        uint32_t const currentStep,
+        T_FieldEGuard const & fieldEDevice,
+        T_FieldBGuard const & fieldBDevice,
+        T_GuardAccesses const & ... guardAccesses
+    );
+
     SimulationDataId m_datasetID;
 
     FieldE *fieldE;
@@ -328,7 +328,63 @@ Particles<
     );
 
     DataConnector & dc = Environment< >::get( ).DataConnector( );
+    auto fieldE = dc.get< FieldE >( FieldE::getName(), true );
+    auto fieldB = dc.get< FieldB >( FieldB::getName(), true );
 
+    /* The pusher margins never exceed one supercell, so the CORE supercells
+     * only read CORE and BORDER field values and can be pushed while the
+     * field guards are still exchanged.
+     */
+    pushArea< T_Pusher, CORE >(
+        currentStep,
+        fieldE->device().data().read().access_dataPlace( CORE + BORDER ),
+        fieldB->device().data().read().access_dataPlace( CORE + BORDER )
+    );
+
+    /* The BORDER supercells read CORE and BORDER in all directions (the
+     * BORDER field updates) and additionally the GUARD, but from the GUARD
+     * only the directions which actually receive data from a neighbor.
+     */
+    Mask const guardE = fieldE->getGridBuffer().getReceiveMask();
+    Mask const guardB = fieldB->getGridBuffer().getReceiveMask();
+    pushArea< T_Pusher, BORDER >(
+        currentStep,
+        fieldE->device().data().read().access_dataPlace( CORE + BORDER ),
+        fieldB->device().data().read().access_dataPlace( CORE + BORDER ),
+        fieldE->device().data().read().access_dataPlace( GUARD ).access_directions( guardE ),
+        fieldB->device().data().read().access_dataPlace( GUARD ).access_directions( guardB )
+    );
+
+    /* moves particles between supercells of both areas and therefore
+     * depends on both pushes, in practice the border push is the later one
+     */
+    ParticlesBaseType::template shiftParticles < CORE + BORDER > ( );
+}
+
+template<
+    typename T_Name,
+    typename T_Flags,
+    typename T_Attributes
+>
+template<
+    typename T_Pusher,
+    uint32_t T_area,
+    typename T_FieldEGuard,
+    typename T_FieldBGuard,
+    typename... T_GuardAccesses
+>
+void
+Particles<
+    T_Name,
+    T_Flags,
+    T_Attributes
+>::pushArea(
+    uint32_t const currentStep,
+    T_FieldEGuard const & fieldEDevice,
+    T_FieldBGuard const & fieldBDevice,
+    T_GuardAccesses const & ... guardAccesses
+)
+{
     Environment< >::task(
         [
             currentStep,
@@ -336,7 +392,8 @@ Particles<
         ](
             auto fieldEDevice,
             auto fieldBDevice,
-            auto parDevice
+            auto parDevice,
+            auto...
         ){
             using InterpolationScheme = typename pmacc::traits::Resolve<
                 typename GetFlagType<
@@ -371,7 +428,7 @@ Particles<
             >;
 
             AreaMapping<
-                CORE + BORDER,
+                T_area,
                 picongpu::MappingDesc
             > mapper( cellDescription );
 
@@ -392,14 +449,13 @@ Particles<
             );
         },
         TaskProperties::Builder()
-            .label("Particles::push()")
+            .label( T_area == CORE ? "Particles::push(CORE)" : "Particles::push(BORDER)" )
             .scheduling_tags({ SCHED_CUPLA }),
-        dc.get< FieldE >( FieldE::getName(), true )->device().data(),
-        dc.get< FieldB >( FieldB::getName(), true )->device().data(),
-        this->particlesBuffer.device()
+        fieldEDevice,
+        fieldBDevice,
+        this->particlesBuffer.device().access_dataPlace( T_area ),
+        guardAccesses...
     );
-
-    ParticlesBaseType::template shiftParticles < CORE + BORDER > ( );
 }
 
 template<
@@ -154,11 +154,18 @@ struct CallReset
     >;
     using FrameType = typename SpeciesType::FrameType;
 
-    HINLINE void operator()( const uint32_t currentStep )
+    /**
+     * @param currentStep index of time iteration
+     * @param deviceOnly reset only the device buffers of the species
+     */
+    HINLINE void operator()( const uint32_t currentStep, bool const deviceOnly = false )
     {
         DataConnector &dc = Environment<>::get().DataConnector();
         auto species = dc.get< SpeciesType >( FrameType::getName(), true );
-        species->reset( currentStep );
+        if( deviceOnly )
+            species->resetDevice( currentStep );
+        else
+            species->reset( currentStep );
         dc.releaseData( FrameType::getName() );
     }
 };
@@ -166,9 +166,6 @@ namespace ionization
                 density->template computeValue< CORE + BORDER, DensitySolver >(*srcSpecies, currentStep);
                 dc.releaseData( SrcSpecies::FrameType::getName() );
 
-                density->communication();
-                density->communicationGather();
-
                 /* load species without copying the particle data to the host */
                 auto destSpecies = dc.get< DestSpecies >( DestSpecies::FrameType::getName(), true );
 
@@ -184,8 +181,9 @@ namespace ionization
                 eneKinDens->template computeValue< CORE + BORDER, EnergyDensitySolver >(*destSpecies, currentStep);
                 dc.releaseData( DestSpecies::FrameType::getName() );
 
-                eneKinDens->communication();
-                eneKinDens->communicationGather();
+                // both fields are sent in one message per neighbor
+                FieldTmp::communication( { density, eneKinDens } );
+                FieldTmp::communicationGather( { density, eneKinDens } );
 
                 /* initialize device-side density- and energy density field databox pointers */
                 rhoBox = density->device().data().getDataBox();
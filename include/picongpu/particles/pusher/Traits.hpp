@@ -20,6 +20,8 @@
 #pragma once
 
 #include "picongpu/particles/pusher/particlePusherComposite.hpp"
+#include "picongpu/particles/pusher/particlePusherBoris.hpp"
+#include "picongpu/particles/pusher/particlePusherVay.hpp"
 
 #include <pmacc/traits/IsBaseTemplateOf.hpp>
 
@@ -49,6 +51,30 @@ namespace pusher
     {
     };
 
+    /** Check if a pusher can push several particles in SIMD lanes
+     *
+     * Such a pusher interpolates each field once at the position before the
+     * push and only changes the momentum and the position, so the fields of
+     * all lanes can be interpolated in front of the push.
+     *
+     * @tparam T_Pusher pusher type
+     * @treturn ::type std::true_type or std::false_type
+     */
+    template< typename T_Pusher >
+    struct IsVectorizable : public std::integral_constant<
+        bool,
+        pmacc::traits::IsBaseTemplateOf_t<
+            particlePusherBoris::Push,
+            T_Pusher
+        >::value ||
+        pmacc::traits::IsBaseTemplateOf_t<
+            particlePusherVay::Push,
+            T_Pusher
+        >::value
+    >
+    {
+    };
+
 } // namespace pusher
 } // namespace particles
 } // namespace picongpu
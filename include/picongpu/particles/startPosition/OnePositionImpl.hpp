@@ -22,6 +22,7 @@
 #include "picongpu/simulation_defines.hpp"
 #include "picongpu/particles/startPosition/OnePositionImpl.def"
 #include "picongpu/particles/startPosition/detail/WeightMacroParticles.hpp"
+#include "picongpu/particles/startPosition/detail/SetWeighting.hpp"
 
 #include <pmacc/traits/HasIdentifier.hpp>
 
@@ -36,39 +37,6 @@ namespace startPosition
 {
 namespace acc
 {
-namespace detail
-{
-    template< bool T_hasWeighting >
-    struct SetWeighting
-    {
-        template< typename T_Particle >
-        HDINLINE void
-        operator()
-        (
-            T_Particle & particle,
-            float_X const weighting
-        )
-        {
-            particle[ weighting_ ] = weighting;
-        }
-    };
-
-    template<>
-    struct SetWeighting< false >
-    {
-        template< typename T_Particle >
-        HDINLINE void
-        operator()
-        (
-            T_Particle &,
-            float_X const
-        )
-        {
-        }
-    };
-
-} // namespace detail
-
     template< typename T_ParamClass >
     struct OnePositionImpl
     {
@@ -92,12 +60,7 @@ namespace detail
             particle[ position_ ] = T_ParamClass{}.inCellOffset.template shrink< simDim >( );
 
             // set the weighting attribute if the particle species has it
-            bool const hasWeighting = pmacc::traits::HasIdentifier<
-                typename T_Particle::FrameType,
-                weighting
-            >::type::value;
-            detail::SetWeighting< hasWeighting > setWeighting;
-            setWeighting(
+            startPosition::detail::SetWeighting{ }(
                 particle,
                 m_weighting
             );
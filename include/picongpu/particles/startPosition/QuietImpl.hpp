@@ -21,6 +21,7 @@
 
 #include "picongpu/simulation_defines.hpp"
 #include "picongpu/particles/startPosition/generic/Free.def"
+#include "picongpu/particles/startPosition/detail/SetWeighting.hpp"
 
 #include <boost/mpl/integral_c.hpp>
 
@@ -85,7 +86,10 @@ namespace acc
 
             particle[ position_ ] = precisionCast< float_X >( inCellCoordinate ) * spacing +
                 spacing * float_X( 0.5 );
-            particle[ weighting_ ] = m_weighting;
+            startPosition::detail::SetWeighting{ }(
+                particle,
+                m_weighting
+            );
 
             --m_currentMacroParticles;
 
@@ -23,6 +23,7 @@
 #include "picongpu/simulation_defines.hpp"
 #include "picongpu/particles/startPosition/generic/FreeRng.def"
 #include "picongpu/particles/startPosition/detail/WeightMacroParticles.hpp"
+#include "picongpu/particles/startPosition/detail/SetWeighting.hpp"
 
 #include <boost/mpl/integral_c.hpp>
 
@@ -66,7 +67,10 @@ namespace acc
                 tmpPos[ d ] = rng( );
 
             particle[ position_ ] = tmpPos;
-            particle[ weighting_ ] = m_weighting;
+            startPosition::detail::SetWeighting{ }(
+                particle,
+                m_weighting
+            );
         }
 
         template< typename T_Particle >
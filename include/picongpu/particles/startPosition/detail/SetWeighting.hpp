@@ -0,0 +1,126 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include <pmacc/traits/HasIdentifier.hpp>
+#include <pmacc/particles/memory/dataTypes/ConstantStaticArray.hpp>
+
+#include <type_traits>
+
+
+namespace picongpu
+{
+namespace particles
+{
+namespace startPosition
+{
+namespace detail
+{
+
+    /** set the weighting of a new macro particle
+     *
+     * Species without the attribute weighting and species with a constant
+     * weighting (pmacc::particles::storage::Constant) are not changed, the
+     * weighting of the latter is defined by the species.
+     */
+    struct SetWeighting
+    {
+        /** set the weighting
+         *
+         * @tparam T_Particle pmacc::Particle, particle type
+         *
+         * @param particle particle to be manipulated
+         * @param value weighting of the macro particle
+         */
+        template< typename T_Particle >
+        HDINLINE void
+        operator()(
+            T_Particle & particle,
+            float_X const value
+        ) const
+        {
+            bool const hasWeighting = pmacc::traits::HasIdentifier<
+                typename T_Particle::FrameType,
+                weighting
+            >::type::value;
+            set(
+                particle,
+                value,
+                std::integral_constant< bool, hasWeighting >{ }
+            );
+        }
+
+    private:
+        template< typename T_Particle >
+        HDINLINE void
+        set(
+            T_Particle & particle,
+            float_X const value,
+            std::true_type
+        ) const
+        {
+            using Reference = typename std::decay<
+                decltype( particle[ weighting_ ] )
+            >::type;
+            assign(
+                particle,
+                value,
+                pmacc::IsConstantReference< Reference >{ }
+            );
+        }
+
+        template< typename T_Particle >
+        HDINLINE void
+        set(
+            T_Particle &,
+            float_X const,
+            std::false_type
+        ) const
+        {
+        }
+
+        template< typename T_Particle >
+        HDINLINE void
+        assign(
+            T_Particle & particle,
+            float_X const value,
+            std::false_type
+        ) const
+        {
+            particle[ weighting_ ] = value;
+        }
+
+        template< typename T_Particle >
+        HDINLINE void
+        assign(
+            T_Particle &,
+            float_X const,
+            std::true_type
+        ) const
+        {
+        }
+    };
+
+} // namespace detail
+} // namespace startPosition
+} // namespace particles
+} // namespace picongpu
@@ -33,6 +33,7 @@
 #include <pmacc/dataManagement/DataConnector.hpp>
 
 #include <pmacc/particles/operations/CountParticles.hpp>
+#include <pmacc/type/AsyncResult.hpp>
 
 #include "common/txtFileHandling.hpp"
 
@@ -64,6 +65,11 @@ private:
     bool writeToFile;
 
     mpi::MPIReduce reduce;
+
+    /* written by every task which accesses outFile,
+     * keeps the lines in the order of the steps
+     */
+    rg::IOResource< int > outFileOrder{ 0 };
 public:
 
     CountParticles() :
@@ -131,6 +137,7 @@ private:
     {
         if(!notifyPeriod.empty())
         {
+            waitForFileWrites();
             if (writeToFile)
             {
                 outFile.flush();
@@ -158,61 +165,71 @@ private:
         if( !writeToFile )
             return;
 
+        waitForFileWrites();
         checkpointTxtFile( outFile,
                            filename,
                            currentStep,
                            checkpointDirectory );
     }
 
+    /* The count, the reductions and the file output are submitted as tasks,
+     * the simulation is not waiting for the result.
+     */
     template< uint32_t AREA>
     void countParticles(uint32_t currentStep)
     {
-        uint64_cu size;
-
-        const SubGrid<simDim>& subGrid = Environment<simDim>::get().SubGrid();
-        const DataSpace<simDim> localSize(subGrid.getLocalDomain().size);
-
         DataConnector &dc = Environment<>::get().DataConnector();
         auto particles = dc.get< ParticlesType >( ParticlesType::FrameType::getName(), true );
 
-        // enforce that the filter interface is fulfilled
-        particles::filter::IUnary< particles::filter::All > parFilter{ currentStep };
-
-        /*count local particles*/
-        size = pmacc::CountParticles::countOnDevice<AREA>(*particles,
-                                                          *cellDescription,
-                                                          DataSpace<simDim>(),
-                                                          localSize,
-                                                          parFilter);
+        /* count local particles
+         *
+         * all particles are counted, the sum of the supercell counts is
+         * sufficient
+         */
+        auto const size = pmacc::CountParticles::countSuperCellsAsync<AREA>(*particles,
+                                                                             *cellDescription);
         dc.releaseData( ParticlesType::FrameType::getName() );
 
-        uint64_cu reducedValueMax;
-        if (picLog::log_level & picLog::CRITICAL::lvl)
-        {
-            reduce(nvidia::functors::Max(),
-                   &reducedValueMax,
-                   &size,
-                   1,
-                   mpi::reduceMethods::Reduce());
-        }
+        bool const logMax = picLog::log_level & picLog::CRITICAL::lvl;
+        auto const reducedValueMax = logMax ?
+            reduce.async(nvidia::functors::Max(),
+                         size,
+                         mpi::reduceMethods::Reduce()) :
+            AsyncResult< uint64_cu >();
 
+        auto const reducedValue = reduce.async(nvidia::functors::Add(),
+                                               size,
+                                               mpi::reduceMethods::Reduce());
 
-        uint64_cu reducedValue;
-        reduce(nvidia::functors::Add(),
-               &reducedValue,
-               &size,
-               1,
-               mpi::reduceMethods::Reduce());
+        if (!writeToFile)
+            return;
 
-        if (writeToFile)
-        {
-            if (picLog::log_level & picLog::CRITICAL::lvl)
+        Environment<>::task(
+            [this, currentStep, logMax]( auto reducedValue, auto reducedValueMax, auto )
             {
-                log<picLog::CRITICAL > ("maximum number of  particles on a GPU : %d\n") % reducedValueMax;
-            }
+                if (logMax)
+                {
+                    log<picLog::CRITICAL > ("maximum number of  particles on a GPU : %d\n") % ( *reducedValueMax )[ 0 ];
+                }
 
-            outFile << currentStep << " " << reducedValue << " " << std::scientific << (float_64) reducedValue << std::endl;
-        }
+                outFile << currentStep << " " << ( *reducedValue )[ 0 ] << " " << std::scientific <<
+                    (float_64) ( *reducedValue )[ 0 ] << std::endl;
+            },
+            TaskProperties::Builder().label("CountParticles::write"),
+            reducedValue.read(),
+            reducedValueMax.read(),
+            outFileOrder.write()
+        );
+    }
+
+    //! wait until all submitted lines are written to outFile
+    void waitForFileWrites()
+    {
+        Environment<>::task(
+            []( auto ){},
+            TaskProperties::Builder().label("CountParticles::waitForFileWrites"),
+            outFileOrder.write()
+        ).get();
     }
 
 };
@@ -93,6 +93,11 @@ private:
 
     nvidia::reduce::Reduce* localReduce;
 
+    /* written by every task which accesses outFile,
+     * keeps the lines in the order of the steps
+     */
+    rg::IOResource< int > outFileOrder{ 0 };
+
     typedef promoteType<float_64, FieldB::ValueType>::type EneVectorType;
 
 public:
@@ -163,6 +168,7 @@ private:
     {
         if(!notifyPeriod.empty())
         {
+            waitForFileWrites();
             if (writeToFile)
             {
                 outFile.flush();
@@ -191,12 +197,16 @@ private:
         if( !writeToFile )
             return;
 
+        waitForFileWrites();
         checkpointTxtFile( outFile,
                            filename,
                            currentStep,
                            checkpointDirectory );
     }
 
+    /* The reductions and the file output are submitted as tasks,
+     * the simulation is not waiting for the result.
+     */
     void getEnergyFields(uint32_t currentStep)
     {
         DataConnector &dc = Environment<>::get().DataConnector();
@@ -204,56 +214,75 @@ private:
         auto fieldE = dc.get< FieldE >( FieldE::getName(), true );
         auto fieldB = dc.get< FieldB >( FieldB::getName(), true );
 
-        /* idx == 0 -> fieldB
-         * idx == 1 -> fieldE
-         */
-        EneVectorType globalFieldEnergy[2];
-        globalFieldEnergy[0]=EneVectorType::create(0.0);
-        globalFieldEnergy[1]=EneVectorType::create(0.0);
-
-        EneVectorType localReducedFieldEnergy[2];
-        localReducedFieldEnergy[0] = reduceField(fieldB);
-        localReducedFieldEnergy[1] = reduceField(fieldE);
-
-        mpiReduce(nvidia::functors::Add(),
-                  globalFieldEnergy,
-                  localReducedFieldEnergy,
-                  2,
-                  mpi::reduceMethods::Reduce());
+        auto globalFieldEnergyB = mpiReduce.async(
+            nvidia::functors::Add(),
+            reduceField(fieldB),
+            mpi::reduceMethods::Reduce()
+        );
+        auto globalFieldEnergyE = mpiReduce.async(
+            nvidia::functors::Add(),
+            reduceField(fieldE),
+            mpi::reduceMethods::Reduce()
+        );
+
+        if (!writeToFile)
+            return;
 
-        float_64 energyFieldBReduced=0.0;
-        float_64 energyFieldEReduced=0.0;
+        Environment<>::task(
+            [this, currentStep]( auto energyB, auto energyE, auto )
+            {
+                /* idx == 0 -> fieldB
+                 * idx == 1 -> fieldE
+                 */
+                EneVectorType globalFieldEnergy[2];
+                globalFieldEnergy[0] = ( *energyB )[ 0 ];
+                globalFieldEnergy[1] = ( *energyE )[ 0 ];
 
-        for(int d=0; d<FieldB::numComponents; ++d)
-        {
-            /* B field convert */
-            globalFieldEnergy[0][d] *= float_64(0.5 / MUE0 * CELL_VOLUME);
-            /* E field convert */
-            globalFieldEnergy[1][d] *= float_64(EPS0 * CELL_VOLUME * 0.5);
-
-            /* add all to one */
-            energyFieldBReduced+= globalFieldEnergy[0][d];
-            energyFieldEReduced+= globalFieldEnergy[1][d];
-        }
+                float_64 energyFieldBReduced=0.0;
+                float_64 energyFieldEReduced=0.0;
 
-        float_64 globalEnergy = energyFieldEReduced + energyFieldBReduced;
+                for(int d=0; d<FieldB::numComponents; ++d)
+                {
+                    /* B field convert */
+                    globalFieldEnergy[0][d] *= float_64(0.5 / MUE0 * CELL_VOLUME);
+                    /* E field convert */
+                    globalFieldEnergy[1][d] *= float_64(EPS0 * CELL_VOLUME * 0.5);
+
+                    /* add all to one */
+                    energyFieldBReduced+= globalFieldEnergy[0][d];
+                    energyFieldEReduced+= globalFieldEnergy[1][d];
+                }
 
+                float_64 globalEnergy = energyFieldEReduced + energyFieldBReduced;
 
-        if (writeToFile)
-        {
-            using dbl = std::numeric_limits<float_64>;
+                using dbl = std::numeric_limits<float_64>;
 
-            outFile.precision(dbl::digits10);
-            outFile << currentStep << " " << std::scientific << globalEnergy * UNIT_ENERGY << " "
-                    << (globalFieldEnergy[0] * UNIT_ENERGY).toString(" ","") << " "
-                    << (globalFieldEnergy[1] * UNIT_ENERGY).toString(" ","") << std::endl;
-        }
+                outFile.precision(dbl::digits10);
+                outFile << currentStep << " " << std::scientific << globalEnergy * UNIT_ENERGY << " "
+                        << (globalFieldEnergy[0] * UNIT_ENERGY).toString(" ","") << " "
+                        << (globalFieldEnergy[1] * UNIT_ENERGY).toString(" ","") << std::endl;
+            },
+            TaskProperties::Builder().label("EnergyFields::write"),
+            globalFieldEnergyB.read(),
+            globalFieldEnergyE.read(),
+            outFileOrder.write()
+        );
     }
 
 private:
 
+    //! wait until all submitted lines are written to outFile
+    void waitForFileWrites()
+    {
+        Environment<>::task(
+            []( auto ){},
+            TaskProperties::Builder().label("EnergyFields::waitForFileWrites"),
+            outFileOrder.write()
+        ).get();
+    }
+
     template<typename T_Field>
-    EneVectorType reduceField( std::shared_ptr< T_Field > field )
+    AsyncResult< EneVectorType > reduceField( std::shared_ptr< T_Field > field )
     {
         /*define stacked DataBox's for reduce algorithm*/
         typedef DataBoxUnaryTransform<typename T_Field::DataBoxType, energyFields::squareComponentWise > TransformedBox;
@@ -268,11 +297,10 @@ private:
         Box64bit field64bit(fieldTransform);
         D1Box d1Access(field64bit, fieldSize);
 
-        EneVectorType fieldEnergyReduced = (*localReduce)(nvidia::functors::Add(),
-                                               d1Access,
-                                               fieldSize.productOfComponents());
-
-        return fieldEnergyReduced;
+        return localReduce->async(nvidia::functors::Add(),
+                                  d1Access,
+                                  fieldSize.productOfComponents(),
+                                  field->device().data().read());
     }
 
 };
@@ -42,6 +42,7 @@
 #include <pmacc/traits/HasIdentifiers.hpp>
 #include <pmacc/traits/HasFlag.hpp>
 #include <pmacc/meta/ForEach.hpp>
+#include <pmacc/type/AsyncResult.hpp>
 
 #include <boost/mpl/and.hpp>
 
@@ -491,6 +492,7 @@ namespace picongpu
 
         virtual ~EnergyParticles( )
         {
+            waitForFileWrites( );
             if( writeToFile )
             {
                 outFile.flush( );
@@ -539,6 +541,7 @@ namespace picongpu
             if( !writeToFile )
                 return;
 
+            waitForFileWrites( );
             checkpointTxtFile(
                 outFile,
                 filename,
@@ -547,7 +550,11 @@ namespace picongpu
             );
         }
     private:
-        //! method to call analysis and plugin-kernel calls
+        /** method to call analysis and plugin-kernel calls
+         *
+         * The kernel, the reduction and the file output are submitted as
+         * tasks, the simulation is not waiting for the result.
+         */
         template< uint32_t AREA >
         void calculateEnergyParticles( uint32_t currentStep )
         {
@@ -560,36 +567,52 @@ namespace picongpu
             );
 
             // initialize global energies with zero
-            gEnergy->getDeviceBuffer( ).setValue( 0.0 );
-
-            constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
-                pmacc::math::CT::volume< SuperCellSize >::type::value
-            >::value;
+            pmacc::mem::buffer::fill( gEnergy->device( ), 0.0 );
 
             AreaMapping<
                 AREA,
                 MappingDesc
             > mapper( *m_cellDescription );
 
-            auto kernel = PMACC_KERNEL( KernelEnergyParticles< numWorkers >{ } )(
-                mapper.getGridDim( ),
-                numWorkers
-            );
-            auto binaryKernel = std::bind(
-                kernel,
-                particles->getDeviceParticlesBox( ),
-                gEnergy->getDeviceBuffer( ).getDataBox( ),
-                mapper,
-                std::placeholders::_1
-            );
+            Environment<>::task(
+                [
+                    mapper,
+                    currentStep,
+                    filterName = m_help->filter.get( m_id )
+                ](
+                    auto parDevice,
+                    auto energyDevice
+                ){
+                    constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+                        pmacc::math::CT::volume< SuperCellSize >::type::value
+                    >::value;
+
+                    auto kernel = PMACC_KERNEL( KernelEnergyParticles< numWorkers >{ } )(
+                        mapper.getGridDim( ),
+                        numWorkers
+                    );
+                    auto binaryKernel = std::bind(
+                        kernel,
+                        parDevice.getParticlesBox( ),
+                        energyDevice.getDataBox( ),
+                        mapper,
+                        std::placeholders::_1
+                    );
 
-            meta::ForEach<
-                typename Help::EligibleFilters,
-                plugins::misc::ExecuteIfNameIsEqual< bmpl::_1 >
-            >{ }(
-                m_help->filter.get( m_id ),
-                currentStep,
-                binaryKernel
+                    meta::ForEach<
+                        typename Help::EligibleFilters,
+                        plugins::misc::ExecuteIfNameIsEqual< bmpl::_1 >
+                    >{ }(
+                        filterName,
+                        currentStep,
+                        binaryKernel
+                    );
+                },
+                TaskProperties::Builder()
+                    .label( "KernelEnergyParticles" )
+                    .scheduling_tags({ SCHED_CUPLA }),
+                particles->getParticlesBuffer( ).device( ),
+                gEnergy->device( ).data( ).write( )
             );
 
             dc.releaseData( ParticlesType::FrameType::getName( ) );
@@ -597,29 +620,54 @@ namespace picongpu
             // get energy from GPU
             gEnergy->deviceToHost( );
 
-            // create storage for the global reduced result
-            float_64 reducedEnergy[2];
+            AsyncResult< float_64 > localEnergy( 2 );
+            Environment<>::task(
+                []( auto energyHost, auto localEnergy )
+                {
+                    ( *localEnergy )[ 0 ] = energyHost.getDataBox( )[ 0 ];
+                    ( *localEnergy )[ 1 ] = energyHost.getDataBox( )[ 1 ];
+                },
+                TaskProperties::Builder( ).label( "EnergyParticles::read" ),
+                gEnergy->host( ).data( ).read( ),
+                localEnergy.write( )
+            );
 
             // add energies from all GPUs using MPI
-            reduce(
+            auto const reducedEnergy = reduce.async(
                 nvidia::functors::Add( ),
-                reducedEnergy,
-                gEnergy->getHostBuffer( ).getBasePointer( ),
-                2,
+                localEnergy,
                 mpi::reduceMethods::Reduce( )
             );
 
             /* print timestep, kinetic energy and total energy to file: */
-            if( writeToFile )
-            {
-                using dbl = std::numeric_limits< float_64 >;
+            if( !writeToFile )
+                return;
 
-                outFile.precision( dbl::digits10 );
-                outFile << currentStep << " "
-                        << std::scientific
-                        << reducedEnergy[ 0 ] * UNIT_ENERGY << " "
-                        << reducedEnergy[ 1 ] * UNIT_ENERGY << std::endl;
-            }
+            Environment<>::task(
+                [ this, currentStep ]( auto reducedEnergy, auto )
+                {
+                    using dbl = std::numeric_limits< float_64 >;
+
+                    outFile.precision( dbl::digits10 );
+                    outFile << currentStep << " "
+                            << std::scientific
+                            << ( *reducedEnergy )[ 0 ] * UNIT_ENERGY << " "
+                            << ( *reducedEnergy )[ 1 ] * UNIT_ENERGY << std::endl;
+                },
+                TaskProperties::Builder( ).label( "EnergyParticles::write" ),
+                reducedEnergy.read( ),
+                outFileOrder.write( )
+            );
+        }
+
+        //! wait until all submitted lines are written to outFile
+        void waitForFileWrites( )
+        {
+            Environment<>::task(
+                []( auto ){},
+                TaskProperties::Builder( ).label( "EnergyParticles::waitForFileWrites" ),
+                outFileOrder.write( )
+            ).get( );
         }
 
         //! energy values (global on GPU)
@@ -645,6 +693,11 @@ namespace picongpu
         //! MPI reduce to add all energies over several GPUs
         mpi::MPIReduce reduce;
 
+        /* written by every task which accesses outFile,
+         * keeps the lines in the order of the steps
+         */
+        rg::IOResource< int > outFileOrder{ 0 };
+
         std::shared_ptr< Help > m_help;
         size_t m_id;
     };
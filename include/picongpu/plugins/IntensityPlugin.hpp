@@ -246,6 +246,8 @@ private:
         const int yLocalSize = localSize.y();
 
         const int gpus = Environment<simDim>::get().GridController().getGpuNodes().productOfComponents();
+        // rank 0 of the topology communicator writes the files
+        MPI_Comm topologyComm = Environment<simDim>::get().GridController().getCommunicator().getMPIComm();
 
 
         /**\todo: fixme I cant work with not regular domains (use mpi_gatherv)*/
@@ -262,14 +264,14 @@ private:
         // avoid deadlock between not finished pmacc tasks and mpi blocking collectives
         __getTransactionEvent().waitForFinished();
         MPI_CHECK(MPI_Gather(&yOffset, 1, MPI_INT, yOffsetsAll, 1,
-                             MPI_INT, 0, MPI_COMM_WORLD));
+                             MPI_INT, 0, topologyComm));
 
         MPI_CHECK(MPI_Gather(localMaxIntensity->getHostBuffer().getBasePointer(), yLocalSize, MPI_FLOAT,
                              maxAllTmp, yLocalSize, MPI_FLOAT,
-                             0, MPI_COMM_WORLD));
+                             0, topologyComm));
         MPI_CHECK(MPI_Gather(localIntegratedIntensity->getHostBuffer().getBasePointer(), yLocalSize, MPI_FLOAT,
                              integretedAllTmp, yLocalSize, MPI_FLOAT,
-                             0, MPI_COMM_WORLD));
+                             0, topologyComm));
 
         if (writeToFile)
         {
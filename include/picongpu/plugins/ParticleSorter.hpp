@@ -0,0 +1,112 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+#include "picongpu/plugins/ILightweightPlugin.hpp"
+
+#include <pmacc/Environment.hpp>
+#include <pmacc/dataManagement/DataConnector.hpp>
+
+#include <string>
+
+
+namespace picongpu
+{
+    using namespace pmacc;
+
+    /** sort the particles of a species inside each supercell by cell index
+     *
+     * Consecutive particles of a frame then access neighboring field values
+     * in the push and neighboring cells in the current deposition.
+     * Every period the disorder of the species is measured (the fraction of
+     * neighboring particles in a frame which are not ordered by cell index,
+     * 0 for sorted and about 0.5 for random order) and logged
+     * (picLog::SIMULATION_STATE). The particles are sorted if the disorder
+     * exceeds the threshold. Sorting fills all gaps, too.
+     *
+     * @tparam T_ParticlesType particle species
+     */
+    template< class T_ParticlesType >
+    class ParticleSorter : public ILightweightPlugin
+    {
+    public:
+        using ParticlesType = T_ParticlesType;
+
+        ParticleSorter() :
+            prefix( ParticlesType::FrameType::getName() + std::string( "_sort" ) )
+        {
+            Environment<>::get().PluginConnector().registerPlugin( this );
+        }
+
+        std::string pluginGetName() const
+        {
+            return "ParticleSorter: sort " + ParticlesType::FrameType::getName() +
+                " particles by cell index";
+        }
+
+        void pluginRegisterHelp( po::options_description & desc )
+        {
+            desc.add_options()
+                ( ( prefix + ".period" ).c_str(), po::value< std::string >( &notifyPeriod ),
+                  "measure the disorder and sort the particles [for each n-th step]" )
+                ( ( prefix + ".threshold" ).c_str(), po::value< float_64 >( &threshold )->default_value( 0.1 ),
+                  "sort if the disorder (fraction of unordered neighboring particles) exceeds this value, "
+                  "0 sorts every period" );
+        }
+
+        void setMappingDescription( MappingDesc * )
+        {
+        }
+
+        void notify( uint32_t currentStep )
+        {
+            DataConnector & dc = Environment<>::get().DataConnector();
+            auto particles = dc.get< ParticlesType >( ParticlesType::FrameType::getName(), true );
+
+            float_64 const disorder = particles->template getDisorder< CORE + BORDER >();
+            bool const sort = disorder > threshold || threshold == 0.0;
+            if( sort )
+                particles->template sortParticles< CORE + BORDER >();
+
+            log< picLog::SIMULATION_STATE >( "ParticleSorter: step %1% species %2% disorder %3%%4%" ) %
+                currentStep % ParticlesType::FrameType::getName() % disorder % ( sort ? " -> sorted" : "" );
+
+            dc.releaseData( ParticlesType::FrameType::getName() );
+        }
+
+    private:
+
+        void pluginLoad()
+        {
+            if( !notifyPeriod.empty() )
+                Environment<>::get().PluginConnector().setNotificationPeriod( this, notifyPeriod );
+        }
+
+        void pluginUnload()
+        {
+        }
+
+        std::string prefix;
+        std::string notifyPeriod;
+        float_64 threshold;
+    };
+
+} // namespace picongpu
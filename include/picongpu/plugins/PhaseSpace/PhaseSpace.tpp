@@ -156,6 +156,9 @@ namespace picongpu
 
             /* Create communicator with ranks of each plane reduce root */
             {
+                /* the global rank is the rank in the topology communicator,
+                 * which can differ from the rank in MPI_COMM_WORLD */
+                MPI_Comm topologyComm = gc.getCommunicator().getMPIComm();
                 /* Array with root ranks of the planeReduce operations */
                 std::vector<int> planeReduceRootRanks( gc.getGlobalSize(), -1 );
                 /* Am I one of the planeReduce root ranks? my global rank : -1 */
@@ -164,12 +167,12 @@ namespace picongpu
 
                 // avoid deadlock between not finished pmacc tasks and mpi blocking collectives
                 __getTransactionEvent().waitForFinished();
-                MPI_Group world_group, new_group;
+                MPI_Group topology_group, new_group;
                 MPI_CHECK(MPI_Allgather( &myRootRank, 1, MPI_INT,
                                          &(planeReduceRootRanks.front()),
                                          1,
                                          MPI_INT,
-                                         MPI_COMM_WORLD ));
+                                         topologyComm ));
 
                 /* remove all non-roots (-1 values) */
                 std::sort( planeReduceRootRanks.begin(), planeReduceRootRanks.end() );
@@ -178,11 +181,11 @@ namespace picongpu
                                                           0 ),
                                         planeReduceRootRanks.end() );
 
-                MPI_CHECK(MPI_Comm_group( MPI_COMM_WORLD, &world_group ));
-                MPI_CHECK(MPI_Group_incl( world_group, ranks.size(), ranks.data(), &new_group ));
-                MPI_CHECK(MPI_Comm_create( MPI_COMM_WORLD, new_group, &commFileWriter ));
+                MPI_CHECK(MPI_Comm_group( topologyComm, &topology_group ));
+                MPI_CHECK(MPI_Group_incl( topology_group, ranks.size(), ranks.data(), &new_group ));
+                MPI_CHECK(MPI_Comm_create( topologyComm, new_group, &commFileWriter ));
                 MPI_CHECK(MPI_Group_free( &new_group ));
-                MPI_CHECK(MPI_Group_free( &world_group ));
+                MPI_CHECK(MPI_Group_free( &topology_group ));
             }
 
             // set how often the plugin should be executed while PIConGPU is running
@@ -90,6 +90,7 @@
 
 #include "picongpu/plugins/ILightweightPlugin.hpp"
 #include "picongpu/plugins/ISimulationPlugin.hpp"
+#include "picongpu/plugins/ParticleSorter.hpp"
 #include "picongpu/particles/traits/SpeciesEligibleForSolver.hpp"
 
 #include <list>
@@ -231,7 +232,8 @@ private:
         plugins::multi::Master< BinEnergyParticles<bmpl::_1> >,
         */
         CountParticles<bmpl::_1>,
-        PngPlugin< Visualisation<bmpl::_1, PngCreator> >
+        PngPlugin< Visualisation<bmpl::_1, PngCreator> >,
+        ParticleSorter<bmpl::_1>
         /*
         plugins::transitionRadiation::TransitionRadiation<bmpl::_1>
 #if(ENABLE_OPENPMD == 1)
@@ -112,9 +112,7 @@ namespace detail
 
             if(contains(propertyMap,"particleCount"))
             {
-                // enforce that the filter interface is fulfilled
-                particles::filter::IUnary< particles::filter::All > parFilter{ currentStep };
-                std::vector<size_t> particleCounts = resourceMonitor.getParticleCounts<VectorAllSpecies>(*cellDescription, parFilter );
+                std::vector<size_t> particleCounts = resourceMonitor.getParticleCounts<VectorAllSpecies>(*cellDescription);
                 valueMap["resourceLog.particleCount"] = std::accumulate(particleCounts.begin(), particleCounts.end(), 0);
             }
 
@@ -31,7 +31,10 @@
 #include <pmacc/assert.hpp>
 #include <pmacc/dataManagement/DataConnector.hpp>
 #include <pmacc/eventSystem/events/kernelEvents.hpp>
+#include <pmacc/Environment.hpp>
 #include <pmacc/mappings/kernel/AreaMapping.hpp>
+#include <pmacc/memory/buffers/GridBuffer.hpp>
+#include <pmacc/memory/buffers/Reset.hpp>
 #include <pmacc/meta/conversion/MakeSeq.hpp>
 #include <pmacc/meta/conversion/RemoveFromSeq.hpp>
 #include <pmacc/particles/ParticleDescription.hpp>
@@ -42,6 +45,8 @@
 #    include <pmacc/particles/memory/buffers/MallocMCBuffer.hpp>
 #endif
 
+#include <redGrapes/resource/ioresource.hpp>
+
 #include <boost/mpl/at.hpp>
 #include <boost/mpl/begin_end.hpp>
 #include <boost/mpl/find.hpp>
@@ -87,7 +92,7 @@ namespace openPMD
             filter( c_filter ),
             particleFilter( c_particleFilter ),
             particleOffset( c_particleOffset ),
-            myNumParticles( c_globalNumParticles ),
+            myNumParticles( c_myNumParticles ),
             globalNumParticles( c_globalNumParticles )
         {
         }
@@ -155,14 +160,22 @@ namespace openPMD
             openPMDFrameType & hostFrame,
             RunParameters rp ) override
         {
+#if( PMACC_CUDA_ENABLED == 1 )
+            if( gatherOnDevice( name, hostFrame, rp ) )
+                return;
+#endif
             log< picLog::INPUT_OUTPUT >(
                 "openPMD:   (begin) copy particle host (with hierarchy) to "
                 "host (without hierarchy): %1%" ) %
                 name;
 #if( PMACC_CUDA_ENABLED == 1 )
+            /* copies the whole frame heap and the supercells of the species
+             * to the host
+             */
             auto mallocMCBuffer =
                 rp.dc.template get< MallocMCBuffer< DeviceHeap > >(
-                    MallocMCBuffer< DeviceHeap >::getName(), true );
+                    MallocMCBuffer< DeviceHeap >::getName() );
+            rp.speciesTmp->synchronize();
 #endif
             int globalParticleOffset = 0;
             AreaMapping< CORE + BORDER, MappingDesc > mapper(
@@ -206,7 +219,133 @@ namespace openPMD
             /* this costs a little bit of time but writing to external is
              * slower in general */
             PMACC_ASSERT(
-                ( uint64_cu )globalParticleOffset == rp.globalNumParticles );
+                ( uint64_cu )globalParticleOffset == rp.myNumParticles );
+        }
+
+    private:
+
+        /** gather the particles into a staging frame in device memory
+         *
+         * The staging frame has the size of the filtered particles, only
+         * this frame is copied to the host instead of the whole frame heap.
+         *
+         * @return false if the staging frame does not fit into the device memory
+         */
+        bool
+        gatherOnDevice(
+            std::string const & name,
+            openPMDFrameType & hostFrame,
+            RunParameters & rp )
+        {
+            openPMDFrameType deviceFrame;
+            bool allocated = true;
+            meta::ForEach<
+                typename openPMDFrameType::ValueTypeSeq,
+                MallocDeviceMemory< bmpl::_1 > >
+                mallocDeviceMem;
+            mallocDeviceMem( deviceFrame, rp.myNumParticles, allocated );
+
+            meta::ForEach<
+                typename openPMDFrameType::ValueTypeSeq,
+                FreeDeviceMemory< bmpl::_1 > >
+                freeDeviceMem;
+            if( !allocated )
+            {
+                freeDeviceMem( deviceFrame );
+                log< picLog::INPUT_OUTPUT >(
+                    "openPMD:   not enough device memory to gather the "
+                    "particles, copy the frame heap: %1%" ) %
+                    name;
+                return false;
+            }
+
+            log< picLog::INPUT_OUTPUT >(
+                "openPMD:   (begin) gather particles on the device: %1%" ) %
+                name;
+            GridBuffer< int, DIM1 > counter( DataSpace< DIM1 >( 1 ) );
+            pmacc::mem::buffer::reset( counter.device(), false );
+
+            // staging frame, written by the gather and read by the copy to the host
+            rg::IOResource< openPMDFrameType > staging( deviceFrame );
+            rg::IOResource< openPMDFrameType * > host( &hostFrame );
+
+            Environment<>::task(
+                [
+                    cellDescription = *( rp.params.cellDescription ),
+                    filter = rp.filter,
+                    particleOffset = rp.particleOffset,
+                    particleFilter = rp.particleFilter
+                ](
+                    auto buffer,
+                    auto counter,
+                    auto staging
+                ){
+                    AreaMapping< CORE + BORDER, MappingDesc > mapper(
+                        cellDescription );
+
+                    constexpr uint32_t numWorkers = pmacc::traits::GetNumWorkers<
+                        pmacc::math::CT::volume< SuperCellSize >::type::value >::value;
+
+                    PMACC_KERNEL( CopySpecies< numWorkers >{} )
+                    ( mapper.getGridDim(), numWorkers )(
+                        counter.getBasePointer(),
+                        *staging,
+                        buffer.getParticlesBox(),
+                        filter,
+                        particleOffset,
+                        totalCellIdx_,
+                        mapper,
+                        particleFilter );
+                },
+                TaskProperties::Builder()
+                    .label( "openPMD::CopySpecies" )
+                    .scheduling_tags( { SCHED_CUPLA } ),
+                rp.speciesTmp->getParticlesBuffer().device(),
+                counter.device().data().write(),
+                staging.write()
+            );
+            counter.deviceToHost();
+
+            Environment<>::task(
+                [ numParticles = rp.myNumParticles ]( auto host, auto staging )
+                {
+                    meta::ForEach<
+                        typename openPMDFrameType::ValueTypeSeq,
+                        CopyDeviceToHostMemory< bmpl::_1 > >
+                        copyToHost;
+                    // the frame holds only the pointers to the attributes
+                    openPMDFrameType stagingFrame = *staging;
+                    copyToHost(
+                        **host,
+                        stagingFrame,
+                        numParticles,
+                        redGrapes::thread::current_cupla_stream );
+                },
+                TaskProperties::Builder()
+                    .label( "openPMD::copy staging frame to host" )
+                    .scheduling_tags( { SCHED_CUPLA } ),
+                host.write(),
+                staging.read()
+            );
+
+            // the host frame is written by the caller after prepare()
+            int const numGathered = Environment<>::task(
+                []( auto counterData, auto )
+                {
+                    return counterData.getDataBox()[ 0 ];
+                },
+                TaskProperties::Builder().label( "openPMD::read gather count" ),
+                counter.host().data().read(),
+                host.read()
+            ).get();
+
+            freeDeviceMem( deviceFrame );
+            log< picLog::INPUT_OUTPUT >(
+                "openPMD:   ( end ) gather particles on the device: %1%" ) %
+                name;
+
+            PMACC_ASSERT( ( uint64_t )numGathered == rp.myNumParticles );
+            return true;
         }
     };
 
@@ -434,13 +573,32 @@ namespace openPMD
             log< picLog::INPUT_OUTPUT >(
                 "openPMD:   (begin) count particles: %1%" ) %
                 T_SpeciesFilter::getName();
-            uint64_cu const myNumParticles =
-                pmacc::CountParticles::countOnDevice< CORE + BORDER >(
-                    *speciesTmp,
-                    *( params->cellDescription ),
-                    params->localWindowToDomainOffset,
-                    params->window.localDimensions.size,
-                    particleFilter );
+            /* without a species filter and with a window covering the
+             * local domain all particles are written, the sum of the
+             * supercell counts is sufficient
+             */
+            bool const writeAllParticles =
+                boost::is_same<
+                    typename T_SpeciesFilter::Filter,
+                    particles::filter::All
+                >::value &&
+                params->localWindowToDomainOffset ==
+                    DataSpace< simDim >::create( 0 ) &&
+                params->window.localDimensions.size ==
+                    Environment< simDim >::get()
+                        .SubGrid()
+                        .getLocalDomain()
+                        .size;
+            uint64_cu const myNumParticles = writeAllParticles
+                ? pmacc::CountParticles::countSuperCells< CORE + BORDER >(
+                      *speciesTmp,
+                      *( params->cellDescription ) )
+                : pmacc::CountParticles::countOnDevice< CORE + BORDER >(
+                      *speciesTmp,
+                      *( params->cellDescription ),
+                      params->localWindowToDomainOffset,
+                      params->window.localDimensions.size,
+                      particleFilter );
             uint64_t allNumParticles[ mpiSize ];
             uint64_t globalNumParticles = 0;
             uint64_t myParticleOffset = 0;
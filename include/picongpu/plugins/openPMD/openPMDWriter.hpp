@@ -49,9 +49,6 @@
 #include <pmacc/particles/operations/CountParticles.hpp>
 #include <pmacc/pluginSystem/PluginConnector.hpp>
 #include <pmacc/static_assert.hpp>
-#if( PMACC_CUDA_ENABLED == 1 )
-#    include <pmacc/particles/memory/buffers/MallocMCBuffer.hpp>
-#endif
 #include "picongpu/plugins/misc/SpeciesFilter.hpp"
 #include "picongpu/plugins/openPMD/NDScalars.hpp"
 #include "picongpu/plugins/openPMD/WriteMeta.hpp"
@@ -676,8 +673,7 @@ Please pick either of the following:
             m_help( std::static_pointer_cast< Help >( help ) ),
             m_id( id ),
             m_cellDescription( cellDescription ),
-            outputDirectory( "openPMD" ),
-            lastSpeciesSyncStep( pmacc::traits::limits::Max< uint32_t >::value )
+            outputDirectory( "openPMD" )
         {
             mThreadParams.compressionMethod = m_help->compression.get( id );
 
@@ -935,33 +931,6 @@ Please pick either of the following:
                 }
             }
 
-            /* copy species only one time per timestep to the host */
-            if( mThreadParams.strategy == WriteSpeciesStrategy::ADIOS &&
-                lastSpeciesSyncStep != currentStep )
-            {
-                DataConnector & dc = Environment<>::get().DataConnector();
-
-#if( PMACC_CUDA_ENABLED == 1 )
-                /* synchronizes the MallocMCBuffer to the host side */
-                dc.get< MallocMCBuffer< DeviceHeap > >(
-                    MallocMCBuffer< DeviceHeap >::getName() );
-#endif
-                /* here we are copying all species to the host side since we
-                 * can not say at this point if this time step will need all of
-                 * them for sure (checkpoint) or just some user-defined species
-                 * (dump)
-                 */
-                meta::ForEach<
-                    FileCheckpointParticles,
-                    CopySpeciesToHost< bmpl::_1 > >
-                    copySpeciesToHost;
-                copySpeciesToHost();
-                lastSpeciesSyncStep = currentStep;
-#if( PMACC_CUDA_ENABLED == 1 )
-                dc.releaseData( MallocMCBuffer< DeviceHeap >::getName() );
-#endif
-            }
-
             initWrite();
 
             write( &mThreadParams, mpiTransportParams );
@@ -1424,8 +1393,6 @@ Please pick either of the following:
         /* select MPI method, #OSTs and #aggregators */
         std::string mpiTransportParams;
 
-        uint32_t lastSpeciesSyncStep;
-
         DataSpace< simDim > mpi_pos;
         DataSpace< simDim > mpi_size;
     };
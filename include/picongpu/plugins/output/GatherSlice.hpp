@@ -76,6 +76,10 @@ struct GatherSlice
             reset();
         }
 
+        /* getGlobalRank() is the rank in the (possibly reordered) topology
+         * communicator, the group must be created from the same communicator
+         */
+        MPI_Comm topologyComm = Environment<simDim>::get().GridController().getCommunicator().getMPIComm();
         int countRanks = Environment<simDim>::get().GridController().getGpuNodes().productOfComponents();
         std::vector<int> gatherRanks(countRanks);
         std::vector<int> groupRanks(countRanks);
@@ -83,7 +87,7 @@ struct GatherSlice
         if (!isActive)
             mpiRank = -1;
 
-        MPI_CHECK(MPI_Allgather(&mpiRank, 1, MPI_INT, &gatherRanks[0], 1, MPI_INT, MPI_COMM_WORLD));
+        MPI_CHECK(MPI_Allgather(&mpiRank, 1, MPI_INT, &gatherRanks[0], 1, MPI_INT, topologyComm));
 
         for (int i = 0; i < countRanks; ++i)
         {
@@ -96,10 +100,10 @@ struct GatherSlice
 
         MPI_Group group = MPI_GROUP_NULL;
         MPI_Group newgroup = MPI_GROUP_NULL;
-        MPI_CHECK(MPI_Comm_group(MPI_COMM_WORLD, &group));
+        MPI_CHECK(MPI_Comm_group(topologyComm, &group));
         MPI_CHECK(MPI_Group_incl(group, numRanks, &groupRanks[0], &newgroup));
 
-        MPI_CHECK(MPI_Comm_create(MPI_COMM_WORLD, newgroup, &comm));
+        MPI_CHECK(MPI_Comm_create(topologyComm, newgroup, &comm));
 
         if (mpiRank != -1)
         {
@@ -190,6 +190,78 @@ struct FreeHostMemory
     }
 };
 
+/** allocate memory on the device
+ *
+ * The allocation is skipped if a previous attribute could not be allocated.
+ *
+ * @param success set to false if the allocation failed
+ */
+template<typename T_Attribute>
+struct MallocDeviceMemory
+{
+    template<typename ValueType >
+    HINLINE void operator()(ValueType& v1, const size_t size, bool& success) const
+    {
+        typedef T_Attribute Attribute;
+        typedef typename pmacc::traits::Resolve<Attribute>::type::type type;
+
+        type* ptr = nullptr;
+        if (size != 0 && success)
+        {
+            if (cuplaMalloc((void**)&ptr, size * sizeof (type)) != cuplaSuccess)
+            {
+                // reset the sticky error of the failed allocation
+                cuplaGetLastError();
+                ptr = nullptr;
+                success = false;
+            }
+        }
+        v1.getIdentifier(Attribute()) = VectorDataBox<type>(ptr);
+    }
+};
+
+/** free memory allocated with MallocDeviceMemory
+ */
+template<typename T_Attribute>
+struct FreeDeviceMemory
+{
+    template<typename ValueType >
+    HINLINE void operator()(ValueType& value) const
+    {
+        typedef T_Attribute Attribute;
+        typedef typename pmacc::traits::Resolve<Attribute>::type::type type;
+
+        type* ptr = value.getIdentifier(Attribute()).getPointer();
+        if (ptr != nullptr)
+            CUDA_CHECK(cuplaFree(ptr));
+        value.getIdentifier(Attribute()) = VectorDataBox<type>(nullptr);
+    }
+};
+
+/** copy the first `size` elements of an attribute from the device to the host
+ *
+ * @param stream cupla stream of the copy, e.g. the stream of the calling task
+ */
+template<typename T_Attribute>
+struct CopyDeviceToHostMemory
+{
+    template<typename ValueType >
+    HINLINE void operator()(ValueType& dest, ValueType& src, const size_t size, cuplaStream_t stream) const
+    {
+        typedef T_Attribute Attribute;
+        typedef typename pmacc::traits::Resolve<Attribute>::type::type type;
+
+        if (size != 0)
+            CUDA_CHECK(cuplaMemcpyAsync(
+                dest.getIdentifier(Attribute()).getPointer(),
+                src.getIdentifier(Attribute()).getPointer(),
+                size * sizeof (type),
+                cuplaMemcpyDeviceToHost,
+                stream
+            ));
+    }
+};
+
 /*functor to create a pair for a MapTuple map*/
 struct OperatorCreateVectorBox
 {
@@ -43,12 +43,15 @@
 #include "picongpu/simulation/control/MovingWindow.hpp"
 #include <pmacc/mappings/simulation/SubGrid.hpp>
 #include <pmacc/mappings/simulation/GridController.hpp>
+#include <pmacc/communication/SharedMemoryTransport.hpp>
 
+#include "picongpu/fields/AggregatedExchange.hpp"
 #include "picongpu/fields/FieldE.hpp"
 #include "picongpu/fields/FieldB.hpp"
 #include "picongpu/fields/FieldJ.hpp"
 #include "picongpu/fields/FieldTmp.hpp"
 #include "picongpu/fields/MaxwellSolver/Solvers.hpp"
+#include "picongpu/fields/MaxwellSolver/Patches.hpp"
 #include "picongpu/fields/MaxwellSolver/YeePML/Field.hpp"
 #include "picongpu/fields/background/cellwiseOperation.hpp"
 #include "picongpu/initialization/IInitPlugin.hpp"
@@ -64,6 +67,7 @@
 #include "picongpu/simulation/stage/CurrentInterpolationAndAdditionToEMF.hpp"
 #include "picongpu/simulation/stage/CurrentReset.hpp"
 #include "picongpu/simulation/stage/FieldBackground.hpp"
+#include "picongpu/simulation/stage/FieldTemporalBlocking.hpp"
 #include "picongpu/simulation/stage/MomentumBackup.hpp"
 #include "picongpu/simulation/stage/ParticleIonization.hpp"
 #include "picongpu/simulation/stage/ParticlePush.hpp"
@@ -90,9 +94,7 @@
 #include <pmacc/meta/ForEach.hpp>
 #include "picongpu/particles/ParticlesFunctors.hpp"
 #include "picongpu/particles/InitFunctors.hpp"
-#if( PMACC_CUDA_ENABLED == 1 )
-#   include <pmacc/particles/memory/buffers/MallocMCBuffer.hpp>
-#endif
+#include <pmacc/particles/memory/buffers/MallocMCBuffer.hpp>
 #include <pmacc/particles/traits/FilterByFlag.hpp>
 #include <pmacc/particles/traits/FilterByIdentifier.hpp>
 #include <pmacc/particles/IdProvider.hpp>
@@ -142,6 +144,17 @@ public:
 
             ("threads", po::value<uint32_t>(&n_threads)->default_value(1), "number of cpu threads")
             ("streams", po::value<uint32_t>(&n_streams)->default_value(1), "number of accelerator streams")
+            ("patches", po::value<uint32_t>(&n_patches)->default_value(1),
+             "number of patches the core of the local domain is split into along the slowest dimension, "
+             "the field updates of the patches run as separate tasks (at most 64, Yee-type solvers without PML only)")
+            ("fieldSolver.temporalBlocking", po::value<uint32_t>(&temporalBlockSteps)->default_value(1),
+             "number of steps the field solver advances between two exchanges of the E and B guards, "
+             "limited by GuardSize in memory.param, used while no particles are close to the domain "
+             "boundaries, no laser is initialized, the window does not slide and no boundary has an "
+             "absorber (1 disables it)")
+            ("taskTrace", po::value<std::string>(&taskTraceFile),
+             "record a timeline of all tasks and write it as Chrome-trace JSON "
+             "to <taskTrace>_<rank>.json (open with chrome://tracing or ui.perfetto.dev)")
 
             ("grid,g", po::value<std::vector<uint32_t> > (&gridSize)->multitoken(),
              "size of the simulation grid")
@@ -156,6 +169,12 @@ public:
 
             ("periodic", po::value<std::vector<uint32_t> > (&periodic)->multitoken(),
              "specifying whether the grid is periodic (1) or not (0) in each dimension, default: no periodic dimensions")
+            ("nodeAwareMapping", po::value<bool>(&nodeAwareMapping)->zero_tokens(),
+             "place the ranks of each node in a compact block of devices to reduce the inter-node "
+             "communication, prints the predicted number of inter-node faces")
+            ("sharedMemoryTransport", po::value<bool>(&sharedMemoryTransport)->zero_tokens(),
+             "exchange the messages with neighbors on the same node through shared memory "
+             "instead of MPI")
 
             ("moving,m", po::value<bool>(&slidingWindow)->zero_tokens(), "enable sliding/moving window")
             /* For now we still use the compile-time movePoint variable to set
@@ -219,8 +238,9 @@ public:
             isPeriodic[i] = periodic[i];
         }
 
-        Environment<>::get().initScheduler( n_threads, n_streams );
-        Environment<simDim>::get().initDevices(gpus, isPeriodic);
+        Environment<>::get().initScheduler( n_threads, n_streams, taskTraceFile );
+        SharedMemoryTransport::getInstance().setEnabled(sharedMemoryTransport);
+        Environment<simDim>::get().initDevices(gpus, isPeriodic, nodeAwareMapping);
         pmacc::GridController< simDim > & gc = pmacc::Environment<simDim>::get().GridController();
 
         DataSpace<simDim> myGPUpos(gc.getPosition());
@@ -283,6 +303,19 @@ public:
 
         GridLayout<simDim> layout(gridSizeLocal, GuardSize::toRT() * SuperCellSize::toRT());
         cellDescription = new MappingDesc(layout.getDataSpace(), DataSpace<simDim>(GuardSize::toRT()));
+        if( n_patches > 1u && !fields::maxwellSolver::Patches< fields::Solver >::supported )
+        {
+            if( gc.getGlobalRank() == 0 )
+                log<picLog::PHYSICS >("--patches %1% is ignored: the selected field solver updates the core "
+                                      "by one task (only the Yee, Lehe and ArbitraryOrderFDTD solvers use patches)") %
+                    n_patches;
+            n_patches = 1u;
+        }
+        cellDescription->setNumPatches(n_patches);
+        if( cellDescription->getNumPatches() < n_patches && gc.getGlobalRank() == 0 )
+            log<picLog::PHYSICS >("--patches %1% is reduced to %2%: a patch needs at least one CORE supercell "
+                                  "along the slowest dimension and at most 64 patches are supported") %
+                n_patches % cellDescription->getNumPatches();
 
         if (gc.getGlobalRank() == 0)
         {
@@ -300,6 +333,7 @@ public:
         SimulationHelper<simDim>::pluginUnload();
 
         __delete(myFieldSolver);
+        fieldTemporalBlocking.reset();
 
         /** unshare all registered ISimulationData sets
          *
@@ -325,6 +359,14 @@ public:
 
         // create field solver
         this->myFieldSolver = new fields::Solver(*cellDescription);
+        fieldTemporalBlocking = std::make_unique< simulation::stage::FieldTemporalBlocking >(
+            *cellDescription,
+            temporalBlockSteps
+        );
+        if( temporalBlockSteps > 1u )
+            log<picLog::PHYSICS >("field solver temporal blocking: up to %1% steps per guard exchange (%2% requested)") %
+                simulation::stage::FieldTemporalBlocking::getBlockSteps< fields::Solver >( temporalBlockSteps ) %
+                temporalBlockSteps;
 
         // Initialize random number generator and synchrotron functions, if there are synchrotron or bremsstrahlung Photons
         using AllSynchrotronPhotonsSpecies = typename pmacc::particles::traits::FilterByFlag<
@@ -393,6 +435,8 @@ public:
             )
         );
         cuplaStreamSynchronize( 0 );
+#else
+        deviceHeap = std::make_shared< DeviceHeap >( );
 #endif
 
         /* Allocate helper fields for FLYlite population kinetics for atomic physics
@@ -451,6 +495,27 @@ public:
         auto mallocMCBuffer = std::make_unique< MallocMCBuffer< DeviceHeap > >( deviceHeap );
         dc.consume( std::move( mallocMCBuffer ) );
 #   endif
+#else
+        /* the frames are in host memory which is shared by all ranks of the
+         * host, the pool of each rank grows up to its share minus the
+         * reserved memory
+         */
+        uint32_t const numHostRanks = Environment<simDim>::get().GridController().getNumHostRanks();
+        size_t const freeMemPerRank = freeGpuMem / numHostRanks;
+        if( freeMemPerRank < reservedGpuMemorySize )
+        {
+            std::stringstream msg;
+            msg << "Cannot reserve "
+                << (reservedGpuMemorySize / 1024 / 1024) << " MiB per rank as there is only "
+                << (freeMemPerRank / 1024 / 1024) << " MiB free host memory left for each of "
+                << numHostRanks << " ranks";
+            throw std::runtime_error(msg.str());
+        }
+        deviceHeap->setMaxBytes( freeMemPerRank - reservedGpuMemorySize );
+        log<picLog::MEMORY > ("particle frames are allocated from a frame pool in host memory, limit %1% MiB (%2% ranks on the host)") %
+            ( deviceHeap->getMaxBytes() / 1024 / 1024 ) %
+            numHostRanks;
+        dc.consume( std::make_unique< MallocMCBuffer< DeviceHeap > >( deviceHeap ) );
 #endif
 
         meta::ForEach< VectorAllSpecies, particles::LogMemoryStatisticsForSpecies<bmpl::_1> > logMemoryStatisticsForSpecies;
@@ -531,13 +596,15 @@ public:
             }
         }
 
+        growParticleHeap( step );
+
         size_t freeGpuMem(0u);
         Environment<>::get().MemoryInfo().getMemoryInfo(&freeGpuMem);
         log<picLog::MEMORY > ("free mem after all particles are initialized %1% MiB") % (freeGpuMem / 1024 / 1024);
 
-        // generate valid GUARDS (overwrite)
-        fieldE->communication();
-        fieldB->communication();
+        // generate valid GUARDS (overwrite), E and B are sent in one message per neighbor
+        dc.get< AggregatedExchange >( AggregatedExchange::getNameEB(), true )->communication();
+        dc.releaseData( AggregatedExchange::getNameEB() );
 
         dc.releaseData( FieldE::getName() );
         dc.releaseData( FieldB::getName() );
@@ -554,6 +621,9 @@ public:
     {
         using namespace simulation::stage;
 
+        growParticleHeap( currentStep );
+        ( *fieldTemporalBlocking )( *myFieldSolver, currentStep );
+
         MomentumBackup{ }( currentStep );        
         CurrentReset{ }( currentStep );
 
@@ -585,6 +655,42 @@ public:
         myFieldSolver->update_afterCurrent( currentStep );
     }
 
+    /** add memory to the particle heap if its occupancy exceeds frameHeapGrowthThreshold
+     *
+     * Only the frame pool of CPU accelerators can grow, the mallocMC heap on
+     * GPUs has a fixed size.
+     */
+    void growParticleHeap(uint32_t currentStep)
+    {
+#if( !BOOST_LANG_CUDA && !BOOST_COMP_HIP )
+        size_t const addedBytes = deviceHeap->grow( frameHeapGrowthThreshold );
+        if( addedBytes != 0u )
+        {
+            size_t const allocatedBytes = deviceHeap->getAllocatedBytes();
+            log<picLog::MEMORY > ("step %1%: frame pool grown by %2% MiB to %3% MiB, %4% MiB in use (limit %5% MiB)") %
+                currentStep %
+                ( addedBytes / 1024 / 1024 ) %
+                ( allocatedBytes / 1024 / 1024 ) %
+                ( deviceHeap->getUsedBytes() / 1024 / 1024 ) %
+                ( deviceHeap->getMaxBytes() / 1024 / 1024 );
+        }
+
+        // log only if the pool reaches its limit or drops below the threshold again
+        bool const atLimit = addedBytes == 0u &&
+            deviceHeap->getUsedBytes() > frameHeapGrowthThreshold * deviceHeap->getAllocatedBytes();
+        if( atLimit && !particleHeapAtLimit )
+            log<picLog::MEMORY > ("step %1%: frame pool reached its limit of %2% MiB, %3% MiB in use") %
+                currentStep %
+                ( deviceHeap->getMaxBytes() / 1024 / 1024 ) %
+                ( deviceHeap->getUsedBytes() / 1024 / 1024 );
+        else if( !atLimit && particleHeapAtLimit )
+            log<picLog::MEMORY > ("step %1%: frame pool occupancy is below the growth threshold again, %2% MiB in use") %
+                currentStep %
+                ( deviceHeap->getUsedBytes() / 1024 / 1024 );
+        particleHeapAtLimit = atLimit;
+#endif
+    }
+
     virtual void movingWindowCheck(uint32_t currentStep)
     {
         if (MovingWindow::getInstance().slideInCurrentStep(currentStep))
@@ -627,6 +733,28 @@ public:
         resetParticles( currentStep );
     }
 
+    /** clear the local domain of a rank which enters the moving window
+     *
+     * Only the device buffers are cleared, the host buffers are not read
+     * before the next synchronization overwrites them.
+     */
+    void resetEnteringDomain(uint32_t currentStep)
+    {
+        resetFields( currentStep, true );
+        meta::ForEach<
+            VectorAllSpecies,
+            particles::CallReset< bmpl::_1 >
+        > resetParticles;
+        resetParticles( currentStep, true );
+    }
+
+    /** slide the moving window by one device row
+     *
+     * All ranks shift their position along y, only the ranks which wrap
+     * around to the end enter the window. Their whole local domain is the
+     * entering slab, it is cleared and initialized while all other ranks
+     * keep their state and continue without any reset.
+     */
     void slide(uint32_t currentStep)
     {
         GridController<simDim>& gc = Environment<simDim>::get().GridController();
@@ -634,7 +762,7 @@ public:
         if (gc.slide())
         {
             log<picLog::SIMULATION_STATE > ("slide in step %1%") % currentStep;
-            resetAll(currentStep);
+            resetEnteringDomain(currentStep);
             initialiserController->slide(currentStep);
             meta::ForEach< particles::InitPipeline, particles::CallFunctor< bmpl::_1 > > initSpecies;
             initSpecies( currentStep );
@@ -657,8 +785,14 @@ protected:
 
     std::shared_ptr<DeviceHeap> deviceHeap;
 
+    //! true if the frame pool could not grow below frameHeapGrowthThreshold in the last step
+    bool particleHeapAtLimit = false;
+
     fields::Solver* myFieldSolver;
 
+    //! stage starting temporal blocks of the field solver, keeps the pending particle count
+    std::unique_ptr< simulation::stage::FieldTemporalBlocking > fieldTemporalBlocking;
+
 #if( PMACC_CUDA_ENABLED == 1 )
     // creates lookup tables for the bremsstrahlung effect
     // map<atomic number, scaled bremsstrahlung spectrum>
@@ -681,6 +815,8 @@ protected:
     /** Without guards */
     DataSpace<simDim> gridSizeLocal;
     std::vector<uint32_t> periodic;
+    bool nodeAwareMapping = false;
+    bool sharedMemoryTransport = false;
 
     std::vector<std::string> gridDistribution;
 
@@ -692,15 +828,24 @@ protected:
 
     uint32_t n_threads;
     uint32_t n_streams;
+    uint32_t n_patches;
+    //! requested number of steps of a temporal block of the field solver
+    uint32_t temporalBlockSteps;
+    //! file prefix for the task timeline, empty if tracing is disabled
+    std::string taskTraceFile;
 
 private:
 
     void initFields( DataConnector& dataConnector )
     {
         auto fieldB = std::make_unique< FieldB >( *cellDescription );
-        dataConnector.consume( std::move( fieldB ) );
         auto fieldE = std::make_unique< FieldE >( *cellDescription );
+        auto fieldsEB = std::make_unique< AggregatedExchange >( AggregatedExchange::getNameEB(), FIELD_EB );
+        fieldsEB->add( fieldE->getGridBuffer() );
+        fieldsEB->add( fieldB->getGridBuffer() );
+        dataConnector.consume( std::move( fieldB ) );
         dataConnector.consume( std::move( fieldE ) );
+        dataConnector.consume( std::move( fieldsEB ) );
         auto fieldJ = std::make_unique< FieldJ >( *cellDescription );
         dataConnector.consume( std::move( fieldJ ) );
         for( uint32_t slot = 0; slot < fieldTmpNumSlots; ++slot)
@@ -713,10 +858,11 @@ private:
     /** Reset all fields
      *
      * @param currentStep iteration number of the current step
+     * @param deviceOnly reset only the device buffers of the fields
      */
-    void resetFields( uint32_t const currentStep )
+    void resetFields( uint32_t const currentStep, bool const deviceOnly = false )
     {
-        auto resetField = [currentStep]( std::string const name )
+        auto resetField = [currentStep, deviceOnly]( std::string const name )
         {
             DataConnector & dc = Environment<>::get().DataConnector();
             auto const fieldExists = dc.hasId( name );
@@ -726,7 +872,9 @@ private:
                 auto field = std::dynamic_pointer_cast< FieldHelper >(
                     dc.get< ISimulationData >( name, true )
                 );
-                if( field )
+                if( field && deviceOnly )
+                    field->resetDevice( currentStep );
+                else if( field )
                     field->reset( currentStep );
                 dc.releaseData( name );
             }
@@ -0,0 +1,228 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+#include "picongpu/fields/LaserPhysics.hpp"
+#include "picongpu/fields/MaxwellSolver/TemporalBlocking.hpp"
+#include "picongpu/fields/absorber/Absorber.hpp"
+#include "picongpu/simulation/control/MovingWindow.hpp"
+
+#include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/Environment.hpp>
+#include <pmacc/meta/ForEach.hpp>
+#include <pmacc/mpi/MPIReduce.hpp>
+#include <pmacc/mpi/reduceMethods/AllReduce.hpp>
+#include <pmacc/nvidia/functors/Add.hpp>
+#include <pmacc/particles/operations/CountParticles.hpp>
+#include <pmacc/type/Area.hpp>
+#include <pmacc/type/AsyncResult.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+
+
+namespace picongpu
+{
+namespace simulation
+{
+namespace stage
+{
+namespace detail
+{
+
+    //! add the number of particles of a species in the BORDER
+    template< typename T_Species >
+    struct CountBorderParticles
+    {
+        void operator()(
+            AsyncResult< uint64_cu > & numParticles,
+            MappingDesc const & cellDescription
+        ) const
+        {
+            DataConnector & dc = Environment< >::get( ).DataConnector( );
+            auto species = dc.get< T_Species >( T_Species::FrameType::getName( ), true );
+            auto const count = pmacc::CountParticles::countSuperCellsAsync< type::BORDER >(
+                *species,
+                cellDescription
+            );
+            dc.releaseData( T_Species::FrameType::getName( ) );
+
+            Environment< >::task(
+                []( auto numParticles, auto count )
+                {
+                    ( *numParticles )[ 0 ] += ( *count )[ 0 ];
+                },
+                TaskProperties::Builder( ).label( "CountBorderParticles" ),
+                numParticles.write( ),
+                count.read( )
+            );
+        }
+    };
+
+} // namespace detail
+
+    /** Functor for the stage of the PIC loop starting temporal blocks of the field solver
+     *
+     * A block of numSteps steps starts at steps which are a multiple of
+     * numSteps if during the whole block
+     *   - no rank has particles in its BORDER, so that no current of a
+     *     neighbor reaches the local domain,
+     *   - no current background is added,
+     *   - the laser is not initialized,
+     *   - the moving window is not sliding.
+     * No block is started if a boundary has an absorber: the absorber is
+     * not applied to the copies of the absorber cells which are updated in
+     * the GUARD of the neighbors during a block.
+     *
+     * The BORDER particles are counted and reduced over all ranks by tasks
+     * at each multiple of numSteps. The result decides on the block which
+     * starts numSteps steps later, so the stage never waits for the
+     * reduction of the current step.
+     */
+    class FieldTemporalBlocking
+    {
+    public:
+
+        /** Create a temporal blocking functor
+         *
+         * @param cellDescription mapping for kernels
+         * @param numSteps requested number of steps of a block, 1 disables the blocking
+         */
+        FieldTemporalBlocking(
+            MappingDesc const cellDescription,
+            uint32_t const numSteps
+        ):
+            cellDescription( cellDescription ),
+            numSteps( numSteps ),
+            hasAbsorber( false )
+        {
+            auto const thickness = fields::absorber::getGlobalThickness( );
+            for( uint32_t axis = 0u; axis < simDim; ++axis )
+                for( uint32_t direction = 0u; direction < 2u; ++direction )
+                    if( thickness( axis, direction ) != 0u )
+                        hasAbsorber = true;
+
+            // create the communicator of the reduction before the first step
+            if( numSteps > 1u )
+                reduce.participate( true );
+        }
+
+        /** start a temporal block of the field solver if possible
+         *
+         * @param solver field solver
+         * @param step index of time iteration
+         */
+        template< typename T_Solver >
+        void operator( )(
+            T_Solver & solver,
+            uint32_t const step
+        )
+        {
+            using TemporalBlocking = fields::maxwellSolver::TemporalBlocking< T_Solver >;
+            uint32_t const blockSteps = getBlockSteps< T_Solver >( numSteps );
+
+            if( blockSteps < 2u || FieldBackgroundJ::activated || hasAbsorber ||
+                TemporalBlocking::isInBlock( solver ) || step % blockSteps != 0u )
+                return;
+
+            /* BORDER particles of the previous multiple of blockSteps, the
+             * reduction was submitted a whole block ago
+             */
+            bool const noBorderParticles = borderParticles &&
+                borderParticlesStep + blockSteps == step &&
+                borderParticles->get( ) == 0u;
+
+            AsyncResult< uint64_cu > localBorderParticles;
+            Environment< >::task(
+                []( auto numParticles )
+                {
+                    ( *numParticles )[ 0 ] = 0u;
+                },
+                TaskProperties::Builder( ).label( "FieldTemporalBlocking::reset" ),
+                localBorderParticles.write( )
+            );
+            meta::ForEach<
+                VectorAllSpecies,
+                detail::CountBorderParticles< bmpl::_1 >
+            > countBorderParticles;
+            countBorderParticles( localBorderParticles, cellDescription );
+
+            borderParticles.emplace( reduce.async(
+                nvidia::functors::Add( ),
+                localBorderParticles,
+                mpi::reduceMethods::AllReduce( )
+            ) );
+            borderParticlesStep = step;
+
+            if( !noBorderParticles )
+                return;
+
+            /* slideInCurrentStep() counts the slides, future steps can not be
+             * queried: no block while the window may slide at all
+             */
+            if( MovingWindow::getInstance( ).isSlidingWindowActive( step + blockSteps - 1u ) )
+                return;
+
+            for( uint32_t s = step; s < step + blockSteps; ++s )
+                if( fields::LaserPhysics::isActive( s ) )
+                    return;
+
+            TemporalBlocking::begin( solver, blockSteps );
+        }
+
+        /** effective number of steps of a block
+         *
+         * @tparam T_Solver field solver
+         * @param numSteps requested number of steps
+         * @return requested number limited by the GUARD of the solver
+         */
+        template< typename T_Solver >
+        static uint32_t getBlockSteps( uint32_t const numSteps )
+        {
+            uint32_t const maxSteps = fields::maxwellSolver::TemporalBlocking< T_Solver >::maxSteps;
+            return std::min( numSteps, maxSteps );
+        }
+
+    private:
+
+        //! Mapping for kernels
+        MappingDesc cellDescription;
+
+        //! requested number of steps of a block
+        uint32_t numSteps;
+
+        //! true if a boundary of the global domain has an absorber
+        bool hasAbsorber;
+
+        mpi::MPIReduce reduce;
+
+        //! global number of BORDER particles, empty before the first count
+        std::optional< AsyncResult< uint64_cu > > borderParticles;
+
+        //! step of the count in borderParticles
+        uint32_t borderParticlesStep = 0u;
+
+    };
+
+} // namespace stage
+} // namespace simulation
+} // namespace picongpu
@@ -44,6 +44,8 @@ enum CommunicationTag
     FIELD_E = 2u,
     FIELD_J = 3u,
     FIELD_JRECV = 4u,
+    //! FIELD_E and FIELD_B in one message per neighbor
+    FIELD_EB = 5u,
     SPECIES_FIRSTTAG = 42u
 };
 
@@ -33,12 +33,17 @@
 #include "pmacc/mappings/simulation/Filesystem.hpp"
 #include "pmacc/Environment.def"
 #include "pmacc/communication/manager_common.hpp"
+#include "pmacc/communication/SharedMemoryTransport.hpp"
 #include "pmacc/assert.hpp"
 
 #include <pmacc/type/Scheduler.hpp>
+#include <pmacc/type/TaskTrace.hpp>
+#include "pmacc/simulationControl/StepCompletion.hpp"
 
 #include <mpi.h>
 
+#include <string>
+
 namespace pmacc
 {
 
@@ -182,11 +187,30 @@ namespace detail
         void finalize()
         {
             delete ResourceManager_ptr();
+
+            auto & taskTrace = trace::TaskTrace::getInstance();
+            if( taskTrace.isEnabled() && EnvironmentContext::getInstance().isMpiInitialized() )
+            {
+                int rank;
+                MPI_CHECK(MPI_Comm_rank(MPI_COMM_WORLD, &rank));
+                taskTrace.write( rank );
+            }
+
             EnvironmentContext::getInstance().finalize();
         }
 
-        void initScheduler( int n_threads, int n_cupla_streams )
+        /** create the task manager and its schedulers
+         *
+         * @param n_threads number of worker threads for the default scheduler
+         * @param n_cupla_streams number of accelerator streams
+         * @param taskTraceFile if not empty, record a timeline of all tasks
+         *                      and write it to `<taskTraceFile>_<rank>.json`
+         */
+        void initScheduler( int n_threads, int n_cupla_streams, std::string const & taskTraceFile = "" )
         {
+            if( ! taskTraceFile.empty() )
+                trace::TaskTrace::getInstance().enable( taskTraceFile );
+
             ResourceManager_ptr() = new RedGrapesManager();
             auto& mgr = ResourceManager();
 
@@ -212,6 +236,8 @@ namespace detail
                 [this, cupla_scheduler]
                 {
                     mpi_scheduler().fifo->consume();
+                    // completes the requests of node local messages
+                    SharedMemoryTransport::getInstance().poll();
                     mpi_scheduler().request_pool->poll();
                     cupla_scheduler->poll();
                 };
@@ -224,10 +250,49 @@ namespace detail
             );
         }
 
-        template <typename... Args>
-        auto task(Args&&... args)
+        /** emit a task
+         *
+         * The task is assigned to the currently open simulation step
+         * (see simulationControl::StepCompletion) and recorded in the
+         * task trace if tracing is enabled.
+         */
+        template <typename Functor, typename Builder, typename... Args>
+        auto task(Functor&& f, Builder&& builder, Args&&... args)
         {
-            return ResourceManager().emplace_task( std::forward<Args>(args)... );
+            auto epoch = simulationControl::StepCompletion::getInstance().acquire();
+
+            int64_t traceId = -1;
+            auto & taskTrace = trace::TaskTrace::getInstance();
+            if( taskTrace.isEnabled() )
+            {
+                trace::AccessCollector collector;
+                int dummy[] = { 0, ( collector.add( args ), 0 )... };
+                (void)dummy;
+
+                auto const & tags = builder.prop.required_scheduler_tags;
+                int tag = -1;
+                if( tags.test( SCHED_MPI ) )
+                    tag = SCHED_MPI;
+                else if( tags.test( SCHED_CUPLA ) )
+                    tag = SCHED_CUPLA;
+
+                traceId = taskTrace.enqueue(
+                    builder.prop.label,
+                    tag,
+                    std::move( collector.accesses )
+                );
+            }
+
+            return ResourceManager().emplace_task(
+                [f = std::forward<Functor>(f), epoch = std::move(epoch), traceId](auto&&... taskArgs) mutable -> decltype(auto)
+                {
+                    simulationControl::StepCompletion::Scope stepScope( epoch );
+                    trace::TaskTrace::Scope traceScope( traceId );
+                    return f( std::forward<decltype(taskArgs)>(taskArgs)... );
+                },
+                std::forward<Builder>(builder),
+                std::forward<Args>(args)...
+            );
         }
 
         template <typename... Args>
@@ -442,7 +507,7 @@ public:
     template <typename... Args>
     static auto task(Args&&... args)
     {
-        return get().ResourceManager().emplace_task( std::forward<Args>(args)... );
+        return static_cast< detail::Environment & >( get() ).task( std::forward<Args>(args)... );
     }
 
     template <typename Functor, typename... Args>
@@ -461,17 +526,20 @@ public:
      * @param devices number of devices per simulation dimension
      * @param periodic periodicity each simulation dimension
      *                 (0 == not periodic, 1 == periodic)
+     * @param nodeAwareMapping place the ranks of each node in a compact
+     *                         sub-brick of the device grid
      */
     void initDevices(
         DataSpace< T_dim > devices,
-        DataSpace< T_dim > periodic
+        DataSpace< T_dim > periodic,
+        bool nodeAwareMapping = false
     )
     {
         // initialize the MPI context
         detail::EnvironmentContext::getInstance().init();
 
         // create singleton instances
-        GridController().init( devices, periodic );
+        GridController().init( devices, periodic, nodeAwareMapping );
 
         EnvironmentController();
 
@@ -557,6 +625,7 @@ namespace detail
             // Required by scorep for flushing the buffers
             cuplaDeviceSynchronize();
             m_isMpiInitialized = false;
+            SharedMemoryTransport::getInstance().finalize();
             /* Free the MPI context.
              * The gpu context is freed by the `StreamController`, because
              * MPI and CUDA are independent.
@@ -66,13 +66,29 @@ public:
                                                            Src src,
                                                            uint32_t n)
     {
-        typedef typename traits::GetValueType<Src>::ValueType Type;
-
-        Type localResult = reduce(func, src, n);
-        Type globalResult;
+        return async(func, src, n).get();
+    }
 
-        mpi_reduce(func, &globalResult, &localResult, 1);
-        return globalResult;
+    /* Reduce elements in global gpu memory without waiting for the result
+     *
+     * The device reduction, the copy to the host and the MPI reduction are
+     * chained as tasks.
+     *
+     * @param func functor for reduce which takes two arguments, first argument is the source and get the new reduced value.
+     * Functor must specialize the function getMPI_Op.
+     * @param src a class or a pointer where the reduce algorithm can access the value by operator [] (one dimension access)
+     * @param n number of elements to reduce
+     * @param srcGuards resource guards of the memory accessed by @p src
+     *
+     * @return AsyncResult with the reduced value (same on every mpi instance)
+     */
+    template<class Functor, typename Src, typename ... T_SrcGuards>
+    auto async(Functor func,
+               Src src,
+               uint32_t n,
+               T_SrcGuards const & ... srcGuards)
+    {
+        return mpi_reduce.async(func, reduce.async(func, src, n, srcGuards...));
     }
 private:
     friend class redGrapes::trait::BuildProperties< GlobalReduce >;
@@ -0,0 +1,57 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <alpaka/core/BoostPredef.hpp>
+
+
+/** alignment of per-particle attribute arrays [in byte]
+ *
+ * On CPUs the arrays of a frame start at a cache line, which is the width
+ * of an AVX-512 register, so a frame can be processed with aligned vector
+ * loads. GPUs keep the natural alignment (alignments >16 byte break nvcc,
+ * see https://github.com/ComputationalRadiationPhysics/picongpu/issues/1563).
+ */
+#if( BOOST_LANG_CUDA || BOOST_COMP_HIP )
+#   define PMACC_SIMD_ALIGNMENT 1
+#else
+#   define PMACC_SIMD_ALIGNMENT 64
+#endif
+
+/** vectorize the following loop
+ *
+ * Asserts that the iterations of the loop are independent, which removes
+ * the runtime alias checks. `omp simd` is not used: it privatizes the
+ * particle handles of the loop body and prevents the vectorization.
+ * Expands to nothing in GPU compilations.
+ */
+#if( BOOST_LANG_CUDA || BOOST_COMP_HIP )
+#   define PMACC_PRAGMA_SIMD
+#elif BOOST_COMP_INTEL
+#   define PMACC_PRAGMA_SIMD _Pragma( "ivdep" )
+#elif BOOST_COMP_CLANG
+#   define PMACC_PRAGMA_SIMD _Pragma( "clang loop vectorize(assume_safety)" )
+#elif BOOST_COMP_GNUC
+#   define PMACC_PRAGMA_SIMD _Pragma( "GCC ivdep" )
+#else
+#   define PMACC_PRAGMA_SIMD
+#endif
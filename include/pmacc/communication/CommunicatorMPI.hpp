@@ -26,6 +26,8 @@
 #include <pmacc/Environment.hpp>
 #include "pmacc/communication/ICommunicator.hpp"
 #include "pmacc/communication/manager_common.hpp"
+#include "pmacc/communication/NodeBlockMapping.hpp"
+#include "pmacc/communication/SharedMemoryTransport.hpp"
 #include "pmacc/dimensions/DataSpace.hpp"
 #include "pmacc/memory/dataTypes/Mask.hpp"
 #include "pmacc/types.hpp"
@@ -39,6 +41,8 @@ namespace rg = redGrapes;
 #include <vector>
 #include <utility>
 #include <map>
+#include <mutex>
+#include <tuple>
 
 namespace pmacc
 {
@@ -84,7 +88,7 @@ public:
 
     /*! ctor
      */
-    CommunicatorMPI() : hostRank(0)
+    CommunicatorMPI() : hostRank(0), numHostRanks(1)
     {
         //MPI_Init(nullptr, nullptr);
     }
@@ -94,7 +98,14 @@ public:
      * calls MPI_Finalize
      */
     virtual ~CommunicatorMPI()
-    {}
+    {
+        int finalized = 1;
+        MPI_CHECK_NO_EXCEPT(MPI_Finalized(&finalized));
+        if( !finalized )
+            for( auto & persistent : persistentRequests )
+                if( persistent.second.request != MPI_REQUEST_NULL )
+                    MPI_CHECK_NO_EXCEPT(MPI_Request_free(&persistent.second.request));
+    }
 
     virtual int getRank()
     {
@@ -125,10 +136,13 @@ public:
      *
      * @param nodes number of GPU nodes in each dimension
      * @param periodic specifying whether the grid is periodic (1) or not (0) in each dimension
+     * @param nodeAwareMapping place the ranks of each node in a compact
+     *        sub-brick of the grid instead of using the MPI rank order,
+     *        see NodeBlockMapping
      *
      * \warning throws invalid argument if cx*cy*cz != totalnodes
      */
-    void init(DataSpace<DIM3> numberProcesses, DataSpace<DIM3> periodic)
+    void init(DataSpace<DIM3> numberProcesses, DataSpace<DIM3> periodic, bool nodeAwareMapping = false)
     {
         this->periodic = periodic;
 
@@ -155,12 +169,27 @@ public:
 
         int periods[] = {periodic.x(), periodic.y(), periodic.z()};
 
+        if (nodeAwareMapping)
+            computing_comm = createNodeAwareComm(numberProcesses, periodic);
+
         /*create new communicator based on cartesian coordinates*/
         MPI_CHECK(MPI_Cart_create(computing_comm, DIM, dims, periods, 0, &topology));
 
+        if (computing_comm != MPI_COMM_WORLD)
+            MPI_CHECK(MPI_Comm_free(&computing_comm));
+
         // 3. update Host rank
         updateHostRank();
 
+        /* the global rank is the rank within the topology, it differs from
+         * the rank in MPI_COMM_WORLD if the ranks are mapped to the nodes
+         */
+        MPI_CHECK(MPI_Comm_rank(topology, &mpiRank));
+
+        // shared memory mailboxes for neighbors on the same node, MPI otherwise
+        if (SharedMemoryTransport::getInstance().isEnabled())
+            SharedMemoryTransport::getInstance().init(topology);
+
         //4. update Coordinates
         updateCoordinates();
     }
@@ -175,6 +204,13 @@ public:
         return hostRank;
     }
 
+    /*! returns the number of processes which share the memory of this host
+     */
+    uint32_t getNumHostRanks()
+    {
+        return numHostRanks;
+    }
+
     // description in ICommunicator
 
     virtual const Mask& getCommunicationMask() const
@@ -203,26 +239,27 @@ public:
     {
         if( ExchangeTypeToRank(ex) == -1 )
             return;
-        
-        Environment<DIM>::task(
-            [this, ex, send_data, send_data_count, tag]
-            {
-                MPI_Request request;
-                MPI_CHECK(MPI_Isend(
-                    send_data,
-                    send_data_count,
-                    MPI_CHAR,
-                    ExchangeTypeToRank(ex),
-                    gridExchangeTag + tag,
-                    getMPIComm(),
-                    &request));
-
-                Environment<DIM>::get().mpi_request_pool()->get_status( request );
-            },
-            TaskProperties::Builder()
-                .label("CommunicatorMPI::send (ex = " + std::to_string(ex) + ", tag = " + std::to_string(tag) + ")")
-                .scheduling_tags({ SCHED_MPI })
-        ).get();
+
+        auto & sharedMemory = SharedMemoryTransport::getInstance();
+        if( sharedMemory.isLocal( ex ) )
+        {
+            MPI_Request request = sharedMemory.send( ex, send_data, send_data_count, tag );
+            Environment<DIM>::get().mpi_request_pool()->get_status( request );
+            return;
+        }
+
+        MPI_Request request;
+        MPI_CHECK(MPI_Isend(
+            send_data,
+            send_data_count,
+            MPI_CHAR,
+            ExchangeTypeToRank(ex),
+            gridExchangeTag + tag,
+            getMPIComm(),
+            &request));
+
+        // suspends the calling task until the MPI scheduler detects the completion
+        Environment<DIM>::get().mpi_request_pool()->get_status( request );
     }
 
     // description in ICommunicator
@@ -237,33 +274,134 @@ public:
         if( ExchangeTypeToRank(ex) == -1 )
             return 0;
 
-        return Environment<DIM>::task(
-            [this, ex, recv_data, recv_data_max, tag]
-            {
-                MPI_Request request;
-                MPI_CHECK(MPI_Irecv(
-                    recv_data,
-                    recv_data_max,
-                    MPI_CHAR,
-                    ExchangeTypeToRank(ex),
-                    gridExchangeTag + tag,
-                    getMPIComm(),
-                    &request));
+        MPI_Request request;
+        auto & sharedMemory = SharedMemoryTransport::getInstance();
+        if( sharedMemory.isLocal( ex ) )
+            // neighbor on the same node, the request is completed by the transport
+            request = sharedMemory.recv( ex, recv_data, recv_data_max, tag );
+        else
+            MPI_CHECK(MPI_Irecv(
+                recv_data,
+                recv_data_max,
+                MPI_CHAR,
+                ExchangeTypeToRank(ex),
+                gridExchangeTag + tag,
+                getMPIComm(),
+                &request));
+
+        // suspends the calling task until the MPI scheduler detects the completion
+        MPI_Status status = Environment<DIM>::get().mpi_request_pool()->get_status( request );
+
+        int recv_data_count;
+
+        MPI_CHECK_NO_EXCEPT( MPI_Get_count( &status, MPI_CHAR, &recv_data_count ) );
+        if( recv_data_count == MPI_UNDEFINED )
+            std::cerr << "CommunicatorMPI: undefined number of elements received" << std::endl;
+
+        return recv_data_count;
+    }
+
+    // description in ICommunicator
 
-                MPI_Status status = Environment<DIM>::get().mpi_request_pool()->get_status( request );
+    void sendPersistent(
+        uint32_t ex,
+        char const * send_data,
+        size_t send_data_count,
+        uint32_t tag
+    )
+    {
+        if( ExchangeTypeToRank(ex) == -1 )
+            return;
 
-                int recv_data_count;
+        // node local messages are copied through shared memory, see send()
+        if( SharedMemoryTransport::getInstance().isLocal( ex ) )
+            return send( ex, send_data, send_data_count, tag );
 
-                MPI_CHECK_NO_EXCEPT( MPI_Get_count( &status, MPI_CHAR, &recv_data_count ) );
-                if( recv_data_count == MPI_UNDEFINED )
-                    std::cerr << "CommunicatorMPI: undefined number of elements received" << std::endl;
+        MPI_Request & request = getPersistentRequest(
+            true, ex, const_cast< char * >( send_data ), send_data_count, MPI_CHAR, tag
+        );
 
-                return recv_data_count;
-            },
-            TaskProperties::Builder()
-                .label("CommunicatorMPI::recv (ex = " + std::to_string(ex) + ", tag = " + std::to_string(tag) + ")")
-                .scheduling_tags({ SCHED_MPI })
-        ).get();
+        MPI_CHECK(MPI_Start(&request));
+
+        // suspends the calling task until the MPI scheduler detects the completion
+        Environment<DIM>::get().mpi_request_pool()->get_status( request );
+    }
+
+    // description in ICommunicator
+
+    void sendPersistent(
+        uint32_t ex,
+        void const * send_data,
+        MPI_Datatype datatype,
+        uint32_t tag
+    )
+    {
+        if( ExchangeTypeToRank(ex) == -1 )
+            return;
+
+        MPI_Request & request = getPersistentRequest(
+            true, ex, const_cast< void * >( send_data ), 1u, datatype, tag
+        );
+
+        MPI_CHECK(MPI_Start(&request));
+
+        // suspends the calling task until the MPI scheduler detects the completion
+        Environment<DIM>::get().mpi_request_pool()->get_status( request );
+    }
+
+    // description in ICommunicator
+
+    size_t recvPersistent(
+        uint32_t ex,
+        char * recv_data,
+        size_t recv_data_max,
+        uint32_t tag
+    )
+    {
+        if( ExchangeTypeToRank(ex) == -1 )
+            return 0;
+
+        if( SharedMemoryTransport::getInstance().isLocal( ex ) )
+            return recv( ex, recv_data, recv_data_max, tag );
+
+        MPI_Request & request = getPersistentRequest(
+            false, ex, recv_data, recv_data_max, MPI_CHAR, tag
+        );
+
+        MPI_CHECK(MPI_Start(&request));
+
+        // suspends the calling task until the MPI scheduler detects the completion
+        MPI_Status status = Environment<DIM>::get().mpi_request_pool()->get_status( request );
+
+        int recv_data_count;
+
+        MPI_CHECK_NO_EXCEPT( MPI_Get_count( &status, MPI_CHAR, &recv_data_count ) );
+        if( recv_data_count == MPI_UNDEFINED )
+            std::cerr << "CommunicatorMPI: undefined number of elements received" << std::endl;
+
+        return recv_data_count;
+    }
+
+    // description in ICommunicator
+
+    void recvPersistent(
+        uint32_t ex,
+        void * recv_data,
+        MPI_Datatype datatype,
+        uint32_t tag
+    )
+    {
+        if( ExchangeTypeToRank(ex) == -1 )
+            return;
+
+        MPI_Request & request = getPersistentRequest(
+            false, ex, recv_data, 1u, datatype, tag
+        );
+
+        MPI_CHECK(MPI_Start(&request));
+
+        // suspends the calling task until the MPI scheduler detects the completion
+        Environment<DIM>::get().mpi_request_pool()->get_status( request );
     }
 
     // description in ICommunicator
@@ -325,6 +463,67 @@ protected:
         }
     }
 
+    /*! create a communicator with the rank order of a node aware placement
+     *
+     * The rank of each process in the returned communicator is its rank in
+     * the process grid (see NodeBlockMapping). The predicted number of
+     * inter-node faces is printed by rank 0. If no blocked placement exists
+     * (e.g. a different number of ranks per node) MPI_COMM_WORLD is returned.
+     */
+    MPI_Comm createNodeAwareComm(DataSpace<DIM3> numberProcesses, DataSpace<DIM3> periodic)
+    {
+        int worldRank;
+        MPI_CHECK(MPI_Comm_rank(MPI_COMM_WORLD, &worldRank));
+
+        MPI_Comm nodeComm;
+        MPI_CHECK(MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, worldRank, MPI_INFO_NULL, &nodeComm));
+
+        // the node is identified by the world rank of its first process
+        int localIndex;
+        int leader = worldRank;
+        MPI_CHECK(MPI_Comm_rank(nodeComm, &localIndex));
+        MPI_CHECK(MPI_Bcast(&leader, 1, MPI_INT, 0, nodeComm));
+        MPI_CHECK(MPI_Comm_free(&nodeComm));
+
+        std::vector<int> leaders(mpiSize);
+        std::vector<int> localIndices(mpiSize);
+        MPI_CHECK(MPI_Allgather(&leader, 1, MPI_INT, leaders.data(), 1, MPI_INT, MPI_COMM_WORLD));
+        MPI_CHECK(MPI_Allgather(&localIndex, 1, MPI_INT, localIndices.data(), 1, MPI_INT, MPI_COMM_WORLD));
+
+        // number the nodes in order of their lowest rank
+        std::map<int, int> nodeIds;
+        for (int leaderRank : leaders)
+            nodeIds.emplace(leaderRank, 0);
+        int numNodes = 0;
+        for (auto & node : nodeIds)
+            node.second = numNodes++;
+
+        std::vector<int> nodeOfRank(mpiSize);
+        for (int rank = 0; rank < mpiSize; ++rank)
+            nodeOfRank[rank] = nodeIds[leaders[rank]];
+
+        NodeBlockMapping mapping(numberProcesses, periodic, nodeOfRank, localIndices);
+
+        if (!mapping.isValid())
+        {
+            if (worldRank == 0)
+                std::cout << "node aware mapping: no blocked placement of "
+                    << numNodes << " nodes onto " << numberProcesses.toString()
+                    << " ranks, using the MPI rank order" << std::endl;
+            return MPI_COMM_WORLD;
+        }
+
+        if (worldRank == 0)
+            std::cout << "node aware mapping: " << numNodes << " nodes with "
+                << mapping.getBrick().toString() << " ranks each, predicted inter-node faces "
+                << mapping.getInterNodeFaces() << " (MPI rank order: "
+                << mapping.countInterNodeFaces(nodeOfRank) << ")" << std::endl;
+
+        MPI_Comm comm;
+        MPI_CHECK(MPI_Comm_split(MPI_COMM_WORLD, 0, mapping.getCartRank(worldRank), &comm));
+        return comm;
+    }
+
     /*! gets hostRank
      *
      * process with MPI-rank 0 is the master and builds a map with hostname
@@ -373,6 +572,10 @@ protected:
             // if(hostRank!=0) hostRank--; //!\todo fix mpi hostrank start with 1
         }
 
+        MPI_Comm hostComm;
+        MPI_CHECK(MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, mpiRank, MPI_INFO_NULL, &hostComm));
+        MPI_CHECK(MPI_Comm_size(hostComm, &numHostRanks));
+        MPI_CHECK(MPI_Comm_free(&hostComm));
     }
 
     /*! update coordinates \see getCoordinates
@@ -405,6 +608,10 @@ protected:
 
         communicationMask = Mask();
 
+        // exchange types which do not exist in DIM dimensions have no neighbor
+        for (int i = 0; i < 27; i++)
+            ranks[i] = -1;
+
         for (int i = 1; i<-12 * (int) DIM + 6 * (int) DIM * (int) DIM + 9; i++)
         {
             for (uint32_t j = 0; j < DIM; j++)
@@ -453,6 +660,8 @@ protected:
             //std::cout << "rank: " << rank << " " << i << " : " << ranks[i] << std::endl;
 
         }
+
+        SharedMemoryTransport::getInstance().setNeighbors(topology, ranks);
     }
 
     /*! converts an exchangeType (e.g. RIGHT) to an MPI-rank
@@ -462,12 +671,71 @@ protected:
         return ranks[type];
     }
 
+    /*! get the persistent request of a message
+     *
+     * The request is created with the first call and created again if
+     * the neighbor rank (e.g. after a slide), the memory, the size or the
+     * datatype changed.
+     */
+    MPI_Request & getPersistentRequest(
+        bool isSend,
+        uint32_t ex,
+        void * data,
+        size_t count,
+        MPI_Datatype datatype,
+        uint32_t tag
+    )
+    {
+        std::lock_guard< std::mutex > lock( persistentRequestsMutex );
+
+        PersistentRequest & persistent = persistentRequests[ std::make_tuple( isSend, ex, tag ) ];
+        int const rank = ExchangeTypeToRank(ex);
+
+        if(
+            persistent.request == MPI_REQUEST_NULL ||
+            persistent.rank != rank ||
+            persistent.data != data ||
+            persistent.count != count ||
+            persistent.datatype != datatype
+        )
+        {
+            if( persistent.request != MPI_REQUEST_NULL )
+                MPI_CHECK(MPI_Request_free(&persistent.request));
+
+            if( isSend )
+                MPI_CHECK(MPI_Send_init(
+                    data,
+                    count,
+                    datatype,
+                    rank,
+                    gridExchangeTag + tag,
+                    getMPIComm(),
+                    &persistent.request));
+            else
+                MPI_CHECK(MPI_Recv_init(
+                    data,
+                    count,
+                    datatype,
+                    rank,
+                    gridExchangeTag + tag,
+                    getMPIComm(),
+                    &persistent.request));
+
+            persistent.rank = rank;
+            persistent.data = data;
+            persistent.count = count;
+            persistent.datatype = datatype;
+        }
+
+        return persistent.request;
+    }
+
 private:
     //! coordinates in GPU-Grid [0:cx-1,0:cy-1,0:cz-1]
     DataSpace<DIM> coordinates;
 
     DataSpace<DIM3> periodic;
-    //! MPI communicator (currently MPI_COMM_WORLD)
+    //! cartesian MPI communicator of the process grid, its ranks can differ from MPI_COMM_WORLD
     MPI_Comm topology;
     //! array for exchangetype-to-rank conversion \see ExchangeTypeToRank
     int ranks[27];
@@ -477,11 +745,27 @@ private:
     Mask communicationMask;
     //! rank of this process local to its host (node)
     int hostRank;
+    //! number of processes on the host of this process
+    int numHostRanks;
     //! offset for sliding window
     int yoffset;
 
     int mpiRank;
     int mpiSize;
+
+    //! inactive persistent request of a fixed-size message
+    struct PersistentRequest
+    {
+        MPI_Request request = MPI_REQUEST_NULL;
+        int rank = -1;
+        void * data = nullptr;
+        size_t count = 0;
+        MPI_Datatype datatype = MPI_DATATYPE_NULL;
+    };
+
+    //! persistent requests, key is (isSend, exchange type, tag)
+    std::map< std::tuple< bool, uint32_t, uint32_t >, PersistentRequest > persistentRequests;
+    std::mutex persistentRequestsMutex;
 };
 
 } //namespace pmacc
@@ -54,7 +54,11 @@ public:
      */
     virtual bool setStateAfterSlides(size_t numSlides) = 0;
 
-    /*! start a sending task
+    /*! send data to a neighbor
+     *
+     * Must be called from a task which is scheduled on the MPI scheduler
+     * (SCHED_MPI). The calling task is suspended until the message is
+     * sent, no thread is blocked meanwhile.
      *
      * @param ex                direction to send (enum ExchangeType)
      * @param send_data         pointer to data; should have at least send_data_count bytes
@@ -68,7 +72,11 @@ public:
         uint32_t tag
     ) = 0;
 
-    /*! start a receiving task
+    /*! receive data from a neighbor
+     *
+     * Must be called from a task which is scheduled on the MPI scheduler
+     * (SCHED_MPI). The calling task is suspended until the message is
+     * received, no thread is blocked meanwhile.
      *
      * If recv_data_max is less then send_data_count (on other host) multiple startReceive are needed!
      *
@@ -86,6 +94,72 @@ public:
         uint32_t tag
     ) = 0;
 
+    /*! send a fixed-size message to a neighbor
+     *
+     * Same as send(), but the message is sent with a persistent request
+     * which is reused as long as @p ex, @p tag, @p send_data and
+     * @p send_data_count are the same as in the previous call.
+     * The default implementation calls send().
+     */
+    virtual void sendPersistent(
+        uint32_t ex,
+        char const * send_data,
+        size_t send_data_count,
+        uint32_t tag
+    )
+    {
+        send( ex, send_data, send_data_count, tag );
+    }
+
+    /*! receive a fixed-size message from a neighbor
+     *
+     * Same as recv(), but the message is received with a persistent
+     * request, see sendPersistent().
+     * The default implementation calls recv().
+     *
+     * @return number of received bytes
+     */
+    virtual size_t recvPersistent(
+        uint32_t ex,
+        char * recv_data,
+        size_t recv_data_max,
+        uint32_t tag
+    )
+    {
+        return recv( ex, recv_data, recv_data_max, tag );
+    }
+
+    /*! send one element of an MPI datatype to a neighbor with a persistent request
+     *
+     * Used to send strided memory (e.g. the border of a field on a CPU
+     * accelerator) without packing it into a contiguous buffer first.
+     * Must be called from a task with the scheduling tag SCHED_MPI.
+     *
+     * @param ex exchange type of the neighbor
+     * @param send_data begin of the memory described by @p datatype
+     * @param datatype committed MPI datatype of the message
+     * @param tag message tag
+     */
+    virtual void sendPersistent(
+        uint32_t ex,
+        void const * send_data,
+        MPI_Datatype datatype,
+        uint32_t tag
+    ) = 0;
+
+    /*! receive one element of an MPI datatype from a neighbor with a persistent request
+     *
+     * Counterpart of sendPersistent() with a datatype, the datatype of
+     * the receiver can differ from the datatype of the sender as long as
+     * the type signatures match.
+     */
+    virtual void recvPersistent(
+        uint32_t ex,
+        void * recv_data,
+        MPI_Datatype datatype,
+        uint32_t tag
+    ) = 0;
+
     virtual int getRank()=0;
 
     /*! Return which of the three directions are periodic
@@ -0,0 +1,212 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+#include "pmacc/dimensions/DataSpace.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+namespace pmacc
+{
+
+/*! blocked placement of the ranks of each node onto the process grid
+ *
+ * Each node owns a compact sub-brick of the process grid, so most
+ * neighbor exchanges stay on the node. The brick is the factorization of
+ * the number of ranks per node which divides the process grid and has the
+ * smallest inter-node surface.
+ *
+ * All coordinates use the row-major rank order of MPI_Cart_create
+ * (last dimension runs fastest).
+ */
+class NodeBlockMapping
+{
+public:
+
+    /*!
+     * @param dims number of ranks in each dimension (1 for unused dimensions)
+     * @param periodic periodicity of each dimension (0 or 1)
+     * @param nodeOfRank node index [0;numNodes) of each rank,
+     *        nodes are numbered in order of their lowest rank
+     * @param localIndexOfRank index of each rank within its node
+     */
+    NodeBlockMapping(
+        DataSpace< DIM3 > const & dims,
+        DataSpace< DIM3 > const & periodic,
+        std::vector< int > const & nodeOfRank,
+        std::vector< int > const & localIndexOfRank
+    ) :
+        dims( dims ),
+        periodic( periodic ),
+        cartRankOfRank( nodeOfRank.size() )
+    {
+        int numNodes = 0;
+        for( int node : nodeOfRank )
+            numNodes = std::max( numNodes, node + 1 );
+
+        // a blocked placement needs the same number of ranks on each node
+        std::vector< int > ranksPerNode( numNodes, 0 );
+        for( int node : nodeOfRank )
+            ++ranksPerNode[ node ];
+        for( int n : ranksPerNode )
+            if( n != ranksPerNode[ 0 ] )
+                return;
+
+        int const p = ranksPerNode[ 0 ];
+        uint64_t bestFaces = std::numeric_limits< uint64_t >::max();
+        for( int bx = 1; bx <= p; ++bx )
+            for( int by = 1; bx * by <= p; ++by )
+            {
+                if( p % ( bx * by ) != 0 )
+                    continue;
+                DataSpace< DIM3 > const b( bx, by, p / ( bx * by ) );
+
+                bool divides = true;
+                for( uint32_t d = 0; d < DIM3; ++d )
+                    divides = divides && dims[ d ] % b[ d ] == 0;
+                if( !divides )
+                    continue;
+
+                uint64_t const faces = countBrickFaces( b );
+                if( faces < bestFaces )
+                {
+                    bestFaces = faces;
+                    brick = b;
+                }
+            }
+
+        if( bestFaces == std::numeric_limits< uint64_t >::max() )
+            return;
+
+        DataSpace< DIM3 > const bricks = dims / brick;
+        for( std::size_t rank = 0; rank < nodeOfRank.size(); ++rank )
+        {
+            DataSpace< DIM3 > const brickPos = toCoordinate( nodeOfRank[ rank ], bricks );
+            DataSpace< DIM3 > const localPos = toCoordinate( localIndexOfRank[ rank ], brick );
+            cartRankOfRank[ rank ] = toRank( brickPos * brick + localPos, dims );
+        }
+
+        valid = true;
+    }
+
+    //! true if a blocked placement exists
+    bool isValid() const
+    {
+        return valid;
+    }
+
+    //! number of ranks per node in each dimension
+    DataSpace< DIM3 > getBrick() const
+    {
+        return brick;
+    }
+
+    //! rank in the process grid which is assigned to @p rank
+    int getCartRank( int rank ) const
+    {
+        return cartRankOfRank[ rank ];
+    }
+
+    /*! count neighbor faces between ranks on different nodes
+     *
+     * Each pair of face neighbors is counted once per shared face, this is
+     * the number of inter-node halo exchanges without edges and corners.
+     *
+     * @param nodeOfCartRank node index of each rank in the process grid
+     */
+    uint64_t countInterNodeFaces( std::vector< int > const & nodeOfCartRank ) const
+    {
+        uint64_t faces = 0u;
+        for( int rank = 0; rank < dims.productOfComponents(); ++rank )
+        {
+            DataSpace< DIM3 > const pos = toCoordinate( rank, dims );
+            for( uint32_t d = 0; d < DIM3; ++d )
+            {
+                if( dims[ d ] == 1 )
+                    continue;
+
+                DataSpace< DIM3 > neighbor = pos;
+                ++neighbor[ d ];
+                if( neighbor[ d ] == dims[ d ] )
+                {
+                    if( !periodic[ d ] )
+                        continue;
+                    neighbor[ d ] = 0;
+                }
+
+                if( nodeOfCartRank[ rank ] != nodeOfCartRank[ toRank( neighbor, dims ) ] )
+                    ++faces;
+            }
+        }
+        return faces;
+    }
+
+    //! inter-node faces of the blocked placement
+    uint64_t getInterNodeFaces() const
+    {
+        return countBrickFaces( brick );
+    }
+
+private:
+
+    //! inter-node faces if each node owns a brick of size @p b
+    uint64_t countBrickFaces( DataSpace< DIM3 > const & b ) const
+    {
+        uint64_t faces = 0u;
+        for( uint32_t d = 0; d < DIM3; ++d )
+        {
+            uint64_t const bricks = dims[ d ] / b[ d ];
+            uint64_t cuts = bricks - 1u;
+            if( periodic[ d ] && bricks > 1u )
+                ++cuts;
+            faces += cuts * uint64_t( dims.productOfComponents() / dims[ d ] );
+        }
+        return faces;
+    }
+
+    static DataSpace< DIM3 > toCoordinate( int rank, DataSpace< DIM3 > const & size )
+    {
+        return DataSpace< DIM3 >(
+            rank / ( size[ 1 ] * size[ 2 ] ),
+            ( rank / size[ 2 ] ) % size[ 1 ],
+            rank % size[ 2 ]
+        );
+    }
+
+    static int toRank( DataSpace< DIM3 > const & pos, DataSpace< DIM3 > const & size )
+    {
+        return ( pos[ 0 ] * size[ 1 ] + pos[ 1 ] ) * size[ 2 ] + pos[ 2 ];
+    }
+
+    DataSpace< DIM3 > dims;
+    DataSpace< DIM3 > periodic;
+    DataSpace< DIM3 > brick = DataSpace< DIM3 >( 1, 1, 1 );
+    std::vector< int > cartRankOfRank;
+    bool valid = false;
+};
+
+} // namespace pmacc
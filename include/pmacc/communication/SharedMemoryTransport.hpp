@@ -0,0 +1,489 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/communication/manager_common.hpp"
+#include "pmacc/memory/dataTypes/Mask.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+
+namespace pmacc
+{
+
+/*! message transport between ranks on the same node
+ *
+ * Every rank allocates one segment of a shared memory window
+ * (MPI_Win_allocate_shared over all ranks of the node). The segment holds
+ * one mailbox per exchange direction, a mailbox is a ring of slots which is
+ * written by exactly one neighbor. A message is copied in chunks of at most
+ * slotBytes into the mailbox of the receiving neighbor, the receiver copies
+ * it into the destination. Messages are matched by tag and by a sequence
+ * number per (direction, tag), so messages with the same tag never overtake.
+ *
+ * Messages which arrive before the receive is posted are drained into an
+ * unexpected queue, so a mailbox never blocks the sender of another tag.
+ *
+ * Every send/recv returns a generalized MPI request which is completed by
+ * poll(). The request can be waited for with the MPI request pool like any
+ * other request, i.e. MPI tasks are suspended until the transfer is done.
+ * poll() is called by idle worker threads.
+ *
+ * The transport is disabled by default (see setEnabled()), then all
+ * neighbors are reached over MPI.
+ */
+class SharedMemoryTransport
+{
+public:
+
+    //! number of slots in the mailbox of one direction
+    static constexpr uint32_t numSlots = 4u;
+    //! maximum chunk size of one slot
+    static constexpr std::size_t slotBytes = 64u * 1024u;
+
+    static SharedMemoryTransport& getInstance()
+    {
+        static SharedMemoryTransport instance;
+        return instance;
+    }
+
+    /*! select the transport for neighbors on the same node
+     *
+     * Must be called before the communicator is initialized, see isEnabled().
+     *
+     * @param enabled true to use shared memory, false to use MPI for all neighbors
+     */
+    void setEnabled( bool enabled )
+    {
+        this->enabled = enabled;
+    }
+
+    //! true if the communicator initializes the transport with init()
+    bool isEnabled() const
+    {
+        return enabled;
+    }
+
+    /*! allocate the shared mailboxes
+     *
+     * Collective over all ranks of @p comm. Neighbors which were set before
+     * with setNeighbors() use the transport from now on.
+     *
+     * @param comm communicator of all ranks which exchange data
+     */
+    void init( MPI_Comm comm )
+    {
+        if( nodeComm != MPI_COMM_NULL )
+            return;
+
+        int rank;
+        MPI_CHECK( MPI_Comm_rank( comm, &rank ) );
+        MPI_CHECK( MPI_Comm_split_type( comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm ) );
+
+        int nodeSize;
+        MPI_CHECK( MPI_Comm_size( nodeComm, &nodeSize ) );
+
+        Slot * segment;
+        MPI_CHECK( MPI_Win_allocate_shared(
+            sizeof( Slot ) * numSlots * 27u,
+            sizeof( Slot ),
+            MPI_INFO_NULL,
+            nodeComm,
+            &segment,
+            &window
+        ) );
+        MPI_CHECK( MPI_Win_lock_all( MPI_MODE_NOCHECK, window ) );
+
+        for( uint32_t i = 0; i < numSlots * 27u; ++i )
+            new ( &segment[ i ] ) Slot();
+
+        segments.resize( nodeSize );
+        for( int r = 0; r < nodeSize; ++r )
+        {
+            MPI_Aint size;
+            int dispUnit;
+            MPI_CHECK( MPI_Win_shared_query( window, r, &size, &dispUnit, &segments[ r ] ) );
+        }
+
+        // all mailboxes are initialized before the first message is sent
+        MPI_CHECK( MPI_Win_sync( window ) );
+        MPI_CHECK( MPI_Barrier( nodeComm ) );
+
+        if( neighborComm != MPI_COMM_NULL )
+            updateNeighbors();
+    }
+
+    /*! free the shared mailboxes
+     *
+     * Collective over all ranks of the node, must be called before MPI_Finalize.
+     * All neighbors are reached over MPI afterwards.
+     */
+    void finalize()
+    {
+        if( nodeComm == MPI_COMM_NULL )
+            return;
+
+        MPI_CHECK( MPI_Barrier( nodeComm ) );
+        MPI_CHECK( MPI_Win_unlock_all( window ) );
+        MPI_CHECK( MPI_Win_free( &window ) );
+        MPI_CHECK( MPI_Comm_free( &nodeComm ) );
+        segments.clear();
+        for( auto & rank : neighbors )
+            rank = MPI_PROC_NULL;
+    }
+
+    /*! update the node local ranks of all neighbors
+     *
+     * The message sequence of a direction starts again if its neighbor changed
+     * (e.g. after a slide of the moving window).
+     *
+     * @param comm communicator of @p ranks
+     * @param ranks rank for each exchange type, -1 if there is no neighbor
+     */
+    void setNeighbors( MPI_Comm comm, int const ( &ranks )[ 27 ] )
+    {
+        neighborComm = comm;
+        std::copy( ranks, ranks + 27, neighborRanks );
+
+        if( nodeComm != MPI_COMM_NULL )
+            updateNeighbors();
+    }
+
+    //! true if the neighbor in direction @p ex lives on the same node
+    bool isLocal( uint32_t ex ) const
+    {
+        return neighbors[ ex ] != MPI_PROC_NULL;
+    }
+
+    /*! send a message to a neighbor on the same node
+     *
+     * The message is copied, @p data can be reused as soon as the request is complete.
+     *
+     * @return generalized request which is completed by poll()
+     */
+    MPI_Request send( uint32_t ex, char const * data, std::size_t bytes, uint32_t tag )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        Operation * op = new Operation{ true, ex, tag, sendSeq[ ex ][ tag ]++, const_cast< char * >( data ), bytes };
+        return start( op );
+    }
+
+    /*! receive a message from a neighbor on the same node
+     *
+     * @param recv_data_max capacity of @p data in bytes
+     * @return generalized request which is completed by poll(),
+     *         the number of received bytes is the element count of the status
+     */
+    MPI_Request recv( uint32_t ex, char * data, std::size_t recv_data_max, uint32_t tag )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        Operation * op = new Operation{ false, ex, tag, recvSeq[ ex ][ tag ]++, data, recv_data_max };
+
+        // take chunks which arrived before the receive was posted
+        auto & queue = unexpected[ ex ];
+        for( auto it = queue.begin(); it != queue.end(); )
+            if( it->tag == op->tag && it->seq == op->seq )
+            {
+                deliver( *op, it->offset, it->total, it->data.data(), it->data.size() );
+                it = queue.erase( it );
+            }
+            else
+                ++it;
+
+        return start( op );
+    }
+
+    //! progress all pending transfers and complete their requests
+    void poll()
+    {
+        if( nodeComm == MPI_COMM_NULL )
+            return;
+
+        std::unique_lock< std::mutex > lock( mutex, std::try_to_lock );
+        if( ! lock.owns_lock() )
+            return;
+
+        progress();
+    }
+
+private:
+
+    //! translate the neighbor ranks of setNeighbors() into node local ranks
+    void updateNeighbors()
+    {
+        MPI_Group group, nodeGroup;
+        MPI_CHECK( MPI_Comm_group( neighborComm, &group ) );
+        MPI_CHECK( MPI_Comm_group( nodeComm, &nodeGroup ) );
+
+        std::lock_guard< std::mutex > lock( mutex );
+        for( uint32_t ex = 1; ex < 27; ++ex )
+        {
+            int nodeRank = MPI_PROC_NULL;
+            if( neighborRanks[ ex ] >= 0 )
+            {
+                MPI_CHECK( MPI_Group_translate_ranks( group, 1, &neighborRanks[ ex ], nodeGroup, &nodeRank ) );
+                if( nodeRank == MPI_UNDEFINED )
+                    nodeRank = MPI_PROC_NULL;
+            }
+
+            if( nodeRank != neighbors[ ex ] )
+            {
+                neighbors[ ex ] = nodeRank;
+                sendSeq[ ex ].clear();
+                recvSeq[ ex ].clear();
+                unexpected[ ex ].clear();
+            }
+        }
+
+        MPI_CHECK( MPI_Group_free( &group ) );
+        MPI_CHECK( MPI_Group_free( &nodeGroup ) );
+    }
+
+    enum SlotState : uint32_t
+    {
+        EMPTY = 0u,
+        FULL = 1u
+    };
+
+    //! chunk of a message in shared memory
+    struct Slot
+    {
+        std::atomic< uint32_t > state{ EMPTY };
+        uint32_t tag;
+        uint64_t seq;
+        uint64_t offset;
+        uint64_t total;
+        uint64_t bytes;
+        char data[ slotBytes ];
+    };
+
+    //! chunk which arrived before its receive was posted
+    struct UnexpectedChunk
+    {
+        uint32_t tag;
+        uint64_t seq;
+        uint64_t offset;
+        uint64_t total;
+        std::vector< char > data;
+    };
+
+    struct Operation
+    {
+        bool isSend;
+        uint32_t ex;
+        uint32_t tag;
+        uint64_t seq;
+        char * data;
+        //! message size for sends, capacity for receives
+        std::size_t bytes;
+
+        //! bytes which are copied
+        std::size_t done = 0u;
+        //! message size, known for receives with the first chunk
+        std::size_t total = 0u;
+        bool totalKnown = false;
+        MPI_Request request = MPI_REQUEST_NULL;
+    };
+
+    SharedMemoryTransport() = default;
+
+    //! mailbox of a rank for messages from direction @p ex
+    Slot * mailbox( int nodeRank, uint32_t ex ) const
+    {
+        return static_cast< Slot * >( segments[ nodeRank ] ) + ex * numSlots;
+    }
+
+    //! register the request of an operation, caller holds the mutex
+    MPI_Request start( Operation * op )
+    {
+        MPI_CHECK( MPI_Grequest_start( &queryRequest, &freeRequest, &cancelRequest, op, &op->request ) );
+        MPI_Request request = op->request;
+        pending.push_back( op );
+        progress();
+        return request;
+    }
+
+    //! copy a received chunk into the destination of a receive
+    void deliver( Operation & op, uint64_t offset, uint64_t total, char const * chunk, std::size_t bytes )
+    {
+        op.total = std::min< std::size_t >( total, op.bytes );
+        op.totalKnown = true;
+        if( offset < op.bytes )
+            std::memcpy( op.data + offset, chunk, std::min< std::size_t >( bytes, op.bytes - offset ) );
+        op.done += bytes;
+        if( total > op.bytes )
+            std::cerr << "SharedMemoryTransport: message truncated (" << total << " > " << op.bytes << " bytes)" << std::endl;
+    }
+
+    //! caller holds the mutex
+    void progress()
+    {
+        // drain all full slots of the own mailboxes
+        for( uint32_t ex = 1; ex < 27; ++ex )
+        {
+            if( ! isLocal( ex ) )
+                continue;
+
+            Slot * slots = mailbox( rank(), ex );
+            for( uint32_t s = 0; s < numSlots; ++s )
+            {
+                Slot & slot = slots[ s ];
+                if( slot.state.load( std::memory_order_acquire ) != FULL )
+                    continue;
+
+                auto receiver = std::find_if(
+                    pending.begin(),
+                    pending.end(),
+                    [ & ]( Operation * op )
+                    {
+                        return ! op->isSend && op->ex == ex && op->tag == slot.tag && op->seq == slot.seq;
+                    }
+                );
+
+                if( receiver != pending.end() )
+                    deliver( **receiver, slot.offset, slot.total, slot.data, slot.bytes );
+                else
+                    unexpected[ ex ].push_back( UnexpectedChunk{
+                        slot.tag,
+                        slot.seq,
+                        slot.offset,
+                        slot.total,
+                        std::vector< char >( slot.data, slot.data + slot.bytes )
+                    } );
+
+                slot.state.store( EMPTY, std::memory_order_release );
+            }
+        }
+
+        // post chunks of pending sends into the mailboxes of the neighbors
+        for( Operation * op : pending )
+            if( op->isSend && isLocal( op->ex ) )
+            {
+                Slot * slots = mailbox( neighbors[ op->ex ], Mask::getMirroredExchangeType( op->ex ) );
+                for( uint32_t s = 0; s < numSlots && ! isFinished( *op ); ++s )
+                {
+                    Slot & slot = slots[ s ];
+                    if( slot.state.load( std::memory_order_acquire ) != EMPTY )
+                        continue;
+
+                    std::size_t const chunk = std::min( slotBytes, op->bytes - op->done );
+                    slot.tag = op->tag;
+                    slot.seq = op->seq;
+                    slot.offset = op->done;
+                    slot.total = op->bytes;
+                    slot.bytes = chunk;
+                    std::memcpy( slot.data, op->data + op->done, chunk );
+                    slot.state.store( FULL, std::memory_order_release );
+
+                    op->done += chunk;
+                    op->totalKnown = true;
+                }
+            }
+
+        for( auto it = pending.begin(); it != pending.end(); )
+            if( isFinished( **it ) )
+            {
+                MPI_CHECK( MPI_Grequest_complete( ( *it )->request ) );
+                it = pending.erase( it );
+            }
+            else
+                ++it;
+    }
+
+    static bool isFinished( Operation const & op )
+    {
+        if( op.isSend )
+            // an empty message is sent as one empty chunk
+            return op.totalKnown && op.done == op.bytes;
+        return op.totalKnown && op.done >= op.total;
+    }
+
+    int rank() const
+    {
+        int r;
+        MPI_CHECK( MPI_Comm_rank( nodeComm, &r ) );
+        return r;
+    }
+
+    static int queryRequest( void * extra_state, MPI_Status * status )
+    {
+        Operation const & op = *static_cast< Operation * >( extra_state );
+        MPI_Status_set_elements( status, MPI_CHAR, op.isSend ? op.bytes : op.total );
+        MPI_Status_set_cancelled( status, 0 );
+        status->MPI_SOURCE = MPI_UNDEFINED;
+        status->MPI_TAG = op.tag;
+        return MPI_SUCCESS;
+    }
+
+    static int freeRequest( void * extra_state )
+    {
+        delete static_cast< Operation * >( extra_state );
+        return MPI_SUCCESS;
+    }
+
+    static int cancelRequest( void *, int )
+    {
+        return MPI_SUCCESS;
+    }
+
+    //! true if the communicator initializes the transport
+    bool enabled = false;
+
+    MPI_Comm nodeComm = MPI_COMM_NULL;
+    MPI_Win window = MPI_WIN_NULL;
+    //! base pointer of the segment of each node local rank
+    std::vector< void * > segments;
+
+    //! node local rank of each neighbor, MPI_PROC_NULL if it is not on this node
+    int neighbors[ 27 ] = {
+        MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL,
+        MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL,
+        MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL,
+        MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL,
+        MPI_PROC_NULL, MPI_PROC_NULL, MPI_PROC_NULL
+    };
+
+    //! communicator and ranks of the neighbors, see setNeighbors()
+    MPI_Comm neighborComm = MPI_COMM_NULL;
+    int neighborRanks[ 27 ] = { };
+
+    //! next message sequence number per direction and tag
+    std::map< uint32_t, uint64_t > sendSeq[ 27 ], recvSeq[ 27 ];
+    std::list< UnexpectedChunk > unexpected[ 27 ];
+
+    std::list< Operation * > pending;
+    std::mutex mutex;
+};
+
+} // namespace pmacc
@@ -46,6 +46,18 @@ public:
      */
     virtual void reset(uint32_t currentStep) = 0;
 
+    /**
+     * Reset only the device data.
+     *
+     * Used if the host data is not read before it is overwritten by the
+     * next synchronization, e.g. when a rank enters the moving window.
+     * The default implementation calls reset().
+     */
+    virtual void resetDevice(uint32_t currentStep)
+    {
+        reset(currentStep);
+    }
+
     /**
      * Synchronize data from host to device.
      */
@@ -0,0 +1,102 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "pmacc/types.hpp"
+#include "pmacc/dimensions/DataSpace.hpp"
+
+namespace pmacc
+{
+
+    template<class baseClass>
+    class InnerGuardMapping;
+
+    /**
+     * Maps the blocks of a kernel to CORE + BORDER and the inner supercell
+     * layers of the GUARD.
+     *
+     * The number of GUARD layers is given per side of each dimension. It must
+     * be smaller than the number of guarding supercells, a stencil of the
+     * outermost mapped supercell then reads only cells within the GUARD.
+     */
+    template<
+    template<unsigned, class> class baseClass,
+    unsigned DIM,
+    class SuperCellSize_
+    >
+    class InnerGuardMapping<baseClass<DIM, SuperCellSize_> > : public baseClass<DIM, SuperCellSize_>
+    {
+    public:
+        typedef baseClass<DIM, SuperCellSize_> BaseClass;
+
+        enum
+        {
+            AreaType = CORE + BORDER + GUARD, Dim = BaseClass::Dim
+        };
+
+
+        typedef typename BaseClass::SuperCellSize SuperCellSize;
+
+        /**
+         * @param base mapping description of the local grid
+         * @param lowerLayers number of mapped GUARD supercell layers on the lower side of each dimension
+         * @param upperLayers number of mapped GUARD supercell layers on the upper side of each dimension
+         */
+        HINLINE InnerGuardMapping(
+            BaseClass base,
+            DataSpace<DIM> const & lowerLayers,
+            DataSpace<DIM> const & upperLayers
+        ) : BaseClass(base)
+        {
+            beginSuperCell = this->getGuardingSuperCells() - lowerLayers;
+            gridDim = this->getGridSuperCells() - 2 * this->getGuardingSuperCells() + lowerLayers + upperLayers;
+        }
+
+        /**
+         * Generate grid dimension information for kernel calls
+         *
+         * @return size of the grid
+         */
+        HINLINE DataSpace<DIM> getGridDim() const
+        {
+            return gridDim;
+        }
+
+        /**
+         * Returns index of current logical block
+         *
+         * @param realSuperCellIdx current SuperCell index (block index)
+         * @return mapped SuperCell index
+         */
+        HDINLINE DataSpace<DIM> getSuperCellIndex(const DataSpace<DIM>& realSuperCellIdx) const
+        {
+            return realSuperCellIdx + beginSuperCell;
+        }
+
+    private:
+
+        PMACC_ALIGN(beginSuperCell, DataSpace<DIM>);
+        PMACC_ALIGN(gridDim, DataSpace<DIM>);
+    };
+
+} // namespace pmacc
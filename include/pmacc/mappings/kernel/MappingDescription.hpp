@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <stdexcept>
 #include "pmacc/verify.hpp"
 #include "pmacc/dimensions/DataSpace.hpp"
@@ -123,12 +124,31 @@ public:
         return Environment<DIM>::get().GridController().getGpuNodes() * (gridSuperCells - 2 * guardingSuperCells);
     }
 
+    /*! set the number of patches the CORE is split into (see PatchMapping)
+     *
+     * The number is limited to the number of CORE supercells along the
+     * slowest dimension and to 64 (bits of the patch mask of a GridBuffer access),
+     * check getNumPatches() for the number which is used.
+     */
+    HINLINE void setNumPatches(uint32_t patches)
+    {
+        int const coreSuperCells = gridSuperCells[DIM - 1] - 4 * guardingSuperCells[DIM - 1];
+        numPatches = std::max(1, std::min(std::min(int(patches), coreSuperCells), 64));
+    }
+
+    //! number of patches the CORE is split into
+    HDINLINE uint32_t getNumPatches() const
+    {
+        return numPatches;
+    }
+
 
 protected:
 
     //\todo: keine Eigenschaft einer Zelle
     PMACC_ALIGN(gridSuperCells, DataSpace<DIM>);
     PMACC_ALIGN(guardingSuperCells, DataSpace<DIM>);
+    PMACC_ALIGN(numPatches, uint32_t) = 1u;
 
 };
 
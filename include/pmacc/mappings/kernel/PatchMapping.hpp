@@ -0,0 +1,129 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "pmacc/types.hpp"
+#include "pmacc/dimensions/DataSpace.hpp"
+
+#include <cstdint>
+
+namespace pmacc
+{
+
+    template<class baseClass>
+    class PatchMapping;
+
+    /**
+     * Maps the blocks of a kernel to one patch of the CORE.
+     *
+     * The CORE is split along the slowest dimension into
+     * BaseClass::getNumPatches() slabs of whole supercells. Each patch can be
+     * updated by a separate task which only declares its patch of the CORE
+     * (see access_patches() of the GridBuffer guards), so the patches of a
+     * rank are processed concurrently by the worker threads.
+     */
+    template<
+    template<unsigned, class> class baseClass,
+    unsigned DIM,
+    class SuperCellSize_
+    >
+    class PatchMapping<baseClass<DIM, SuperCellSize_> > : public baseClass<DIM, SuperCellSize_>
+    {
+    public:
+        typedef baseClass<DIM, SuperCellSize_> BaseClass;
+
+        enum
+        {
+            AreaType = CORE, Dim = BaseClass::Dim
+        };
+
+
+        typedef typename BaseClass::SuperCellSize SuperCellSize;
+
+        /**
+         * @param base mapping description of the local grid
+         * @param patch index of the patch, in [0;base.getNumPatches())
+         */
+        HINLINE PatchMapping(BaseClass base, uint32_t patch) : BaseClass(base)
+        {
+            int const coreSuperCells = this->getGridSuperCells()[DIM - 1] - 4 * this->getGuardingSuperCells()[DIM - 1];
+            int const numPatches = this->getNumPatches();
+            patchBegin = patch * coreSuperCells / numPatches;
+            patchSize = (patch + 1) * coreSuperCells / numPatches - patchBegin;
+        }
+
+        /**
+         * Generate grid dimension information for kernel calls
+         *
+         * @return size of the grid
+         */
+        HINLINE DataSpace<DIM> getGridDim() const
+        {
+            DataSpace<DIM> gridDim = this->getGridSuperCells() - 4 * this->getGuardingSuperCells();
+            gridDim[DIM - 1] = patchSize;
+            return gridDim;
+        }
+
+        /**
+         * Returns index of current logical block
+         *
+         * @param realSuperCellIdx current SuperCell index (block index)
+         * @return mapped SuperCell index
+         */
+        HDINLINE DataSpace<DIM> getSuperCellIndex(const DataSpace<DIM>& realSuperCellIdx) const
+        {
+            // skip guard + border == 2 x guard
+            DataSpace<DIM> superCellIdx = realSuperCellIdx + 2 * this->getGuardingSuperCells();
+            superCellIdx[DIM - 1] += patchBegin;
+            return superCellIdx;
+        }
+
+        //! mask of the CORE patch @p patch
+        HINLINE static uint64_t getPatchMask(uint32_t patch)
+        {
+            return uint64_t(1u) << patch;
+        }
+
+        /** mask of the CORE patches read by a stencil update of @p patch
+         *
+         * A stencil reads at most one supercell beyond the updated patch,
+         * which lies within the neighboring patches. Solvers using patches
+         * assert this margin at compile time.
+         */
+        HINLINE uint64_t getStencilMask(uint32_t patch) const
+        {
+            uint64_t mask = getPatchMask(patch);
+            if(patch > 0u)
+                mask |= getPatchMask(patch - 1u);
+            if(patch + 1u < this->getNumPatches())
+                mask |= getPatchMask(patch + 1u);
+            return mask;
+        }
+
+    private:
+
+        PMACC_ALIGN(patchBegin, int);
+        PMACC_ALIGN(patchSize, int);
+    };
+
+} // namespace pmacc
@@ -53,8 +53,9 @@ namespace pmacc
              *
              * @param nodes number of GPU nodes in each dimension
              * @param periodic specifying whether the grid is periodic (1) or not (0) in each dimension
+             * @param nodeAwareMapping place the ranks of each node in a compact sub-brick of the grid
              */
-            void init(DataSpace<DIM> nodes, DataSpace<DIM> periodic = DataSpace<DIM>())
+            void init(DataSpace<DIM> nodes, DataSpace<DIM> periodic = DataSpace<DIM>(), bool nodeAwareMapping = false)
             {
                 static bool commIsInit = false;
                 if (!commIsInit)
@@ -87,7 +88,7 @@ namespace pmacc
                         periodicTmp[2] = periodic[2];
                     }
 
-                    comm.init(tmp, periodicTmp);
+                    comm.init(tmp, periodicTmp, nodeAwareMapping);
                     commIsInit = true;
 
                     Environment<DIM>::get().EnvironmentController().setCommunicator(comm);
@@ -135,6 +136,16 @@ namespace pmacc
                 return comm.getHostRank();
             }
 
+            /**
+             * Returns the number of processes on the current host.
+             *
+             * return number of ranks on host
+             */
+            uint32_t getNumHostRanks() const
+            {
+                return comm.getNumHostRanks();
+            }
+
             /**
              * Returns the global MPI rank of the caller among all hosts.
              *
@@ -52,6 +52,15 @@ namespace pmacc
         template <typename T_Species, typename T_MappingDesc, typename T_ParticleFilter>
         std::vector<std::size_t> getParticleCounts(T_MappingDesc &cellDescription, T_ParticleFilter & parFilter);
 
+        /**
+         * Returns the number of all particles per species on the device
+         *
+         * Sums the particle count of each supercell instead of reading the
+         * frames, see CountParticles::countSuperCells.
+         */
+        template <typename T_Species, typename T_MappingDesc>
+        std::vector<std::size_t> getParticleCounts(T_MappingDesc &cellDescription);
+
     };
 
 } //namespace pmacc
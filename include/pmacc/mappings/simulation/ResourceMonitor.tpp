@@ -19,6 +19,8 @@
  * If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 // pmacc
 #include "pmacc/Environment.hpp"
 #include "pmacc/particles/operations/CountParticles.hpp"
@@ -53,6 +55,22 @@ namespace pmacc
         }
     };
 
+    template<typename T_Species>
+    struct MyCountSuperCellParticles
+    {
+        template <typename T_Vector, typename T_MappingDesc>
+        void operator()(T_Vector & particleCounts, T_MappingDesc & cellDescription)
+        {
+            DataConnector & dc = Environment<>::get().DataConnector();
+
+            uint64_cu totalNumParticles = 0;
+            totalNumParticles = pmacc::CountParticles::countSuperCells < CORE + BORDER > (
+                    *dc.get<T_Species >(T_Species::FrameType::getName(), true),
+                    cellDescription);
+            particleCounts.push_back(totalNumParticles);
+        }
+    };
+
     template<unsigned T_DIM>
     ResourceMonitor<T_DIM>::ResourceMonitor()
     {
@@ -76,4 +94,14 @@ namespace pmacc
         return particleCounts;
     }
 
+    template<unsigned T_DIM>
+    template <typename T_Species, typename T_MappingDesc>
+    std::vector<size_t> ResourceMonitor<T_DIM>::getParticleCounts(T_MappingDesc &cellDescription)
+    {
+        std::vector<size_t> particleCounts;
+        meta::ForEach<T_Species, MyCountSuperCellParticles<bmpl::_1> > countParticles;
+        countParticles(particleCounts, cellDescription);
+        return particleCounts;
+    }
+
 } //namespace pmacc
@@ -0,0 +1,469 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+
+namespace pmacc
+{
+namespace memory
+{
+
+    /** pool allocator for particle frames on CPU accelerators
+     *
+     * Drop-in replacement of the mallocMC heap (`T_DeviceHeap` of
+     * ParticlesBuffer) for accelerators which share the host memory.
+     *
+     * - memory is requested in slabs of `slabSize` bytes, a slab is split
+     *   into blocks of one size class (the frames of one species)
+     * - each thread keeps up to `cacheSize` free blocks per size class,
+     *   most allocations and frees touch only this cache
+     * - caches are refilled from and flushed to a lock-free global free list
+     *   of the size class in batches of `cacheSize / 2` blocks
+     * - new slabs are allocated under a mutex, which is only taken if the
+     *   global free list of a size class is empty
+     * - grow() adds slabs ahead of time from the host, e.g. between time
+     *   steps, if the occupancy of a size class exceeds a threshold
+     *
+     * Slabs are never returned before the pool is destroyed.
+     * A thread caches the blocks of one pool only, using a second pool in the
+     * same thread flushes the cache to the first one.
+     */
+    class FramePool
+    {
+    public:
+        //! bytes allocated at once
+        static constexpr size_t slabSize = 2u * 1024u * 1024u;
+        //! maximum number of different block sizes
+        static constexpr uint32_t maxSizeClasses = 16u;
+        //! free blocks cached per thread and size class
+        static constexpr uint32_t cacheSize = 32u;
+        //! alignment of the blocks, the size of the block header
+        static constexpr size_t alignment = 64u;
+        //! memory limit of a pool without limit
+        static constexpr size_t unlimited = std::numeric_limits< size_t >::max();
+
+    private:
+
+        //! a free block, stored inside the block
+        struct Node
+        {
+            std::atomic< Node* > next;
+        };
+
+        //! header in front of each block
+        struct Header
+        {
+            uint32_t sizeClass;
+        };
+
+        struct SizeClass
+        {
+            //! block size without header, 0 for an unused size class
+            std::atomic< size_t > size{ 0u };
+            /** head of the global free list
+             *
+             * The lower 48 bit are the address of the first node, the upper
+             * 16 bit are a tag which is incremented on each change to avoid
+             * the ABA problem.
+             */
+            std::atomic< uint64_t > head{ 0u };
+            //! number of blocks in all slabs of the size class
+            std::atomic< size_t > numBlocks{ 0u };
+            /** number of blocks not in the global free list
+             *
+             * Blocks in the thread caches are counted as used.
+             */
+            std::atomic< size_t > numUsed{ 0u };
+        };
+
+        struct State;
+
+        //! free blocks of one thread
+        struct ThreadCache
+        {
+            uint64_t poolId = 0u;
+            std::weak_ptr< State > owner;
+            std::array< uint32_t, maxSizeClasses > count{ };
+            std::array< std::array< Node*, cacheSize >, maxSizeClasses > nodes;
+
+            ~ThreadCache()
+            {
+                if( auto state = owner.lock() )
+                    state->flushAll( *this );
+            }
+        };
+
+        struct State
+        {
+            uint64_t const id;
+            //! guarded by slabMutex
+            size_t maxBytes;
+            std::weak_ptr< State > self;
+            std::array< SizeClass, maxSizeClasses > classes;
+
+            std::mutex slabMutex;
+            std::vector< void* > slabs;
+            size_t allocatedBytes = 0u;
+
+            State( uint64_t const poolId, size_t const limit ) :
+                id( poolId ),
+                maxBytes( limit )
+            {
+            }
+
+            ~State()
+            {
+                for( void* slab : slabs )
+                    std::free( slab );
+            }
+
+            static Node* getPtr( uint64_t const tagged )
+            {
+                return reinterpret_cast< Node* >( tagged & ( ( uint64_t( 1u ) << 48 ) - 1u ) );
+            }
+
+            static uint64_t makeTagged( Node* const ptr, uint64_t const oldTagged )
+            {
+                uint64_t const tag = ( ( oldTagged >> 48 ) + 1u ) << 48;
+                return tag | reinterpret_cast< uint64_t >( ptr );
+            }
+
+            //! push the chain first -> ... -> last to the global free list
+            void pushChain( uint32_t const c, Node* const first, Node* const last )
+            {
+                auto & head = classes[ c ].head;
+                uint64_t old = head.load( std::memory_order_relaxed );
+                do
+                {
+                    last->next.store( getPtr( old ), std::memory_order_relaxed );
+                }
+                while( !head.compare_exchange_weak(
+                    old,
+                    makeTagged( first, old ),
+                    std::memory_order_release,
+                    std::memory_order_relaxed
+                ) );
+            }
+
+            //! pop one node of the global free list, nullptr if empty
+            Node* pop( uint32_t const c )
+            {
+                auto & head = classes[ c ].head;
+                uint64_t old = head.load( std::memory_order_acquire );
+                while( Node* const node = getPtr( old ) )
+                {
+                    /* the node can be popped by another thread in between,
+                     * the memory stays valid and the tag lets the exchange fail
+                     */
+                    Node* const next = node->next.load( std::memory_order_relaxed );
+                    if( head.compare_exchange_weak(
+                        old,
+                        makeTagged( next, old ),
+                        std::memory_order_acquire,
+                        std::memory_order_acquire
+                    ) )
+                        return node;
+                }
+                return nullptr;
+            }
+
+            /** find or register the size class of blocks with @p size bytes
+             *
+             * @return maxSizeClasses if all size classes are in use
+             */
+            uint32_t getSizeClass( size_t const size )
+            {
+                for( uint32_t c = 0u; c < maxSizeClasses; ++c )
+                {
+                    size_t classSize = classes[ c ].size.load( std::memory_order_acquire );
+                    if( classSize == 0u )
+                        classes[ c ].size.compare_exchange_strong( classSize, size, std::memory_order_acq_rel );
+                    // classSize is the registered size if the exchange failed
+                    if( classSize == 0u || classSize == size )
+                        return c;
+                }
+                return maxSizeClasses;
+            }
+
+            /** split a new slab into blocks of size class @p c
+             *
+             * @param force add the slab even if the free list is not empty
+             * @return false if the memory limit is reached
+             */
+            bool addSlab( uint32_t const c, bool const force = false )
+            {
+                std::lock_guard< std::mutex > lock( slabMutex );
+                // another thread filled the free list in the meantime
+                if( !force && getPtr( classes[ c ].head.load( std::memory_order_acquire ) ) != nullptr )
+                    return true;
+
+                size_t const stride = alignment + classes[ c ].size.load( std::memory_order_relaxed );
+                size_t bytes = slabSize;
+                if( stride > bytes )
+                    bytes = stride;
+                if( allocatedBytes + bytes > maxBytes )
+                    return false;
+
+                void* const slab = std::malloc( bytes + alignment );
+                if( slab == nullptr )
+                    return false;
+                slabs.push_back( slab );
+                allocatedBytes += bytes;
+
+                char* const begin = reinterpret_cast< char* >(
+                    ( reinterpret_cast< uintptr_t >( slab ) + alignment - 1u ) / alignment * alignment
+                );
+                size_t const numBlocks = bytes / stride;
+                Node* first = nullptr;
+                Node* last = nullptr;
+                for( size_t i = numBlocks; i-- > 0u; )
+                {
+                    char* const block = begin + i * stride;
+                    new( block ) Header{ c };
+                    Node* const node = new( block + alignment ) Node;
+                    node->next.store( first, std::memory_order_relaxed );
+                    first = node;
+                    if( last == nullptr )
+                        last = node;
+                }
+                classes[ c ].numBlocks.fetch_add( numBlocks, std::memory_order_relaxed );
+                pushChain( c, first, last );
+                return true;
+            }
+
+            //! refill the cache of size class @p c, false if out of memory
+            bool refill( ThreadCache & cache, uint32_t const c )
+            {
+                do
+                {
+                    uint32_t const oldCount = cache.count[ c ];
+                    while( cache.count[ c ] < cacheSize / 2u )
+                    {
+                        Node* const node = pop( c );
+                        if( node == nullptr )
+                            break;
+                        cache.nodes[ c ][ cache.count[ c ]++ ] = node;
+                    }
+                    classes[ c ].numUsed.fetch_add( cache.count[ c ] - oldCount, std::memory_order_relaxed );
+                }
+                while( cache.count[ c ] == 0u && addSlab( c ) );
+                return cache.count[ c ] != 0u;
+            }
+
+            //! move the @p n oldest cached blocks of size class @p c to the free list
+            void flush( ThreadCache & cache, uint32_t const c, uint32_t const n )
+            {
+                if( n == 0u )
+                    return;
+                auto & nodes = cache.nodes[ c ];
+                for( uint32_t i = 0u; i + 1u < n; ++i )
+                    nodes[ i ]->next.store( nodes[ i + 1u ], std::memory_order_relaxed );
+                pushChain( c, nodes[ 0 ], nodes[ n - 1u ] );
+                classes[ c ].numUsed.fetch_sub( n, std::memory_order_relaxed );
+                cache.count[ c ] -= n;
+                std::memmove( &nodes[ 0 ], &nodes[ n ], cache.count[ c ] * sizeof( Node* ) );
+            }
+
+            void flushAll( ThreadCache & cache )
+            {
+                for( uint32_t c = 0u; c < maxSizeClasses; ++c )
+                    flush( cache, c, cache.count[ c ] );
+            }
+
+            //! bind the cache of the calling thread to this pool
+            ThreadCache & getCache()
+            {
+                thread_local ThreadCache cache;
+                if( cache.poolId != id )
+                {
+                    if( auto previous = cache.owner.lock() )
+                        previous->flushAll( cache );
+                    cache.count.fill( 0u );
+                    cache.owner = self;
+                    cache.poolId = id;
+                }
+                return cache;
+            }
+
+            void* malloc( size_t const bytes )
+            {
+                size_t const size = ( bytes + alignment - 1u ) / alignment * alignment;
+                uint32_t const c = getSizeClass( size );
+                if( c == maxSizeClasses )
+                    return nullptr;
+
+                ThreadCache & cache = getCache();
+                if( cache.count[ c ] == 0u && !refill( cache, c ) )
+                    return nullptr;
+                return cache.nodes[ c ][ --cache.count[ c ] ];
+            }
+
+            void free( void* const ptr )
+            {
+                if( ptr == nullptr )
+                    return;
+                uint32_t const c = reinterpret_cast< Header* >( static_cast< char* >( ptr ) - alignment )->sizeClass;
+
+                ThreadCache & cache = getCache();
+                if( cache.count[ c ] == cacheSize )
+                    flush( cache, c, cacheSize / 2u );
+                cache.nodes[ c ][ cache.count[ c ]++ ] = new( ptr ) Node;
+            }
+        };
+
+        static uint64_t getNextPoolId()
+        {
+            static std::atomic< uint64_t > nextId{ 1u };
+            return nextId++;
+        }
+
+    public:
+
+        /** handle passed to the kernels, interface of the mallocMC handle
+         *
+         * The handle must not be used after the pool is destroyed.
+         */
+        struct AllocatorHandle
+        {
+            State* state;
+
+            template< typename T_Acc >
+            HINLINE void* malloc( T_Acc const &, size_t const bytes ) const
+            {
+                return state->malloc( bytes );
+            }
+
+            template< typename T_Acc >
+            HINLINE void free( T_Acc const &, void* const ptr ) const
+            {
+                state->free( ptr );
+            }
+        };
+
+        /**
+         * @param maxBytes maximum size of all slabs [in byte],
+         *                 malloc returns nullptr if the limit is reached
+         */
+        FramePool( size_t const maxBytes = unlimited ) :
+            m_state( std::make_shared< State >( getNextPoolId(), maxBytes ) )
+        {
+            m_state->self = m_state;
+        }
+
+        FramePool( FramePool const & ) = delete;
+        FramePool & operator=( FramePool const & ) = delete;
+
+        AllocatorHandle getAllocatorHandle()
+        {
+            return AllocatorHandle{ m_state.get() };
+        }
+
+        //! size of all slabs [in byte]
+        size_t getAllocatedBytes()
+        {
+            std::lock_guard< std::mutex > lock( m_state->slabMutex );
+            return m_state->allocatedBytes;
+        }
+
+        /** size of all blocks in use [in byte]
+         *
+         * Free blocks in the thread caches are counted as used, the value is
+         * exact up to `cacheSize` blocks per thread and size class.
+         */
+        size_t getUsedBytes()
+        {
+            size_t usedBytes = 0u;
+            for( auto const & sizeClass : m_state->classes )
+                usedBytes += sizeClass.numUsed.load( std::memory_order_relaxed ) *
+                    ( alignment + sizeClass.size.load( std::memory_order_relaxed ) );
+            return usedBytes;
+        }
+
+        //! memory limit [in byte], @see unlimited
+        size_t getMaxBytes()
+        {
+            std::lock_guard< std::mutex > lock( m_state->slabMutex );
+            return m_state->maxBytes;
+        }
+
+        /** change the memory limit
+         *
+         * Slabs above a lower limit are kept.
+         *
+         * @param maxBytes maximum size of all slabs [in byte], @see unlimited
+         */
+        void setMaxBytes( size_t const maxBytes )
+        {
+            std::lock_guard< std::mutex > lock( m_state->slabMutex );
+            m_state->maxBytes = maxBytes;
+        }
+
+        /** add slabs to all size classes with an occupancy above a threshold
+         *
+         * Slabs are added until the fraction of used blocks of each size class
+         * is at most @p threshold or the memory limit is reached. Can be
+         * called while kernels allocate frames.
+         *
+         * @param threshold occupancy in (0;1]
+         * @return number of bytes added
+         */
+        size_t grow( double const threshold )
+        {
+            size_t const oldBytes = getAllocatedBytes();
+            for( uint32_t c = 0u; c < maxSizeClasses; ++c )
+            {
+                auto const & sizeClass = m_state->classes[ c ];
+                if( sizeClass.size.load( std::memory_order_acquire ) == 0u )
+                    break;
+                while(
+                    double( sizeClass.numUsed.load( std::memory_order_relaxed ) ) >
+                    threshold * double( sizeClass.numBlocks.load( std::memory_order_relaxed ) ) &&
+                    m_state->addSlab( c, true )
+                )
+                {
+                }
+            }
+            return getAllocatedBytes() - oldBytes;
+        }
+
+    private:
+        /* shared with the thread caches, which flush their blocks at thread
+         * exit only if the pool still exists
+         */
+        std::shared_ptr< State > m_state;
+    };
+
+} // namespace memory
+} // namespace pmacc
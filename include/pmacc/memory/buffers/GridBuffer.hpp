@@ -196,6 +196,9 @@ struct GridBuffer
      *        might need to know the size of the buffer)
      * @param sizeOnDeviceReceive if true, internal receive buffers must store their
      *        size additionally on the device
+     *
+     * The exchanged areas have a fixed size, their messages are sent with
+     * persistent MPI requests.
      */
     void addExchange(
         uint32_t dataPlace,
@@ -245,7 +248,8 @@ struct GridBuffer
                     sendex,
                     uniqCommunicationTag,
                     useMpiDirect,
-                    sizeOnDeviceSend);
+                    sizeOnDeviceSend,
+                    true);
                 }
                 else
                     throw std::runtime_error("Exchange already added!");
@@ -262,7 +266,8 @@ struct GridBuffer
                         recvex,
                         uniqCommunicationTag,
                         useMpiDirect,
-                        sizeOnDeviceRecv);
+                        sizeOnDeviceRecv,
+                        true);
                 }
                 else
                     throw std::runtime_error("Exchange already added!");
@@ -69,6 +69,13 @@ struct GuardBase
         return data.obj->getPitch();
     }
 
+    /*! get extent of the base buffer (elements per dimension)
+     */
+    DataSpace< dim > getCapacity() const noexcept
+    {
+        return data.obj->get_capacity();
+    }
+
     //protected:
     friend Buffer;
 
@@ -56,6 +56,12 @@ struct Access
      */
     Mask direction;
 
+    /*! which patches of the CORE are used?
+     * bit k is set if CORE patch k is accessed,
+     * this applies only for CORE (see PatchMapping).
+     */
+    uint64_t patches;
+
     /*
     //! really neccessary?, will be initialized in ExchangeGuard
     Access(
@@ -89,15 +95,17 @@ struct Access
             rg::access::IOAccess::is_serial(a.mode, b.mode)
         )
         {
-            // core is unrelated to direction
+            // core is unrelated to direction,
+            // but can be split into disjoint patches
             if(
                 ( a.area & CORE ) &&
-                ( b.area & CORE )
+                ( b.area & CORE ) &&
+                ( a.patches & b.patches )
             )
                 return true;
 
             // test directions for border & guard
-            else
+            if( a.area & b.area & ( BORDER + GUARD ) )
             {
                 for( int ex = 0; ex < 27; ++ex )
                     if(
@@ -106,9 +114,9 @@ struct Access
                     )
                         // found one direction that is used by both
                         return true;
-
-                return false;
             }
+
+            return false;
         }
         else
             return false;
@@ -121,6 +129,9 @@ struct Access
             (~this->area & other.area) == 0
             &&
             this->mode.is_superset_of( other.mode )
+            &&
+            // other doesn't have any core patch thats not included in this->patches
+            ( !( other.area & CORE ) || (~this->patches & other.patches) == 0 )
         )
         {
             // other is core only, we don't need to check directions
@@ -151,7 +162,8 @@ struct Access
     {
         return
             a.area == b.area &&
-            a.direction == b.direction;
+            a.direction == b.direction &&
+            a.patches == b.patches;
     }
 };
 
@@ -173,6 +185,7 @@ struct buffer::data::ReadGuard<
 {
     uint32_t area;
     Mask directions;
+    uint64_t patches = ~0ull;
 
     friend Buffer;
     friend class rg::trait::BuildProperties< ReadGuard >;
@@ -181,12 +194,14 @@ struct buffer::data::ReadGuard<
         : buffer::data::ReadGuardBase< Buffer >( other )
         , area(other.area)
         , directions(other.directions)
+        , patches(other.patches)
     {}
 
     ReadGuard( buffer::data::WriteGuard< Buffer > const & other )
         : buffer::data::ReadGuardBase< Buffer >( other )
         , area(other.area)
         , directions(other.directions)
+        , patches(other.patches)
     {}
 
     //! read guard for whole buffer
@@ -198,10 +213,16 @@ struct buffer::data::ReadGuard<
             this->directions = this->directions + Mask(i);
     }
 
-    ReadGuard( GuardBase< Buffer > const & base, uint32_t const & area, Mask const & directions )
+    ReadGuard(
+        GuardBase< Buffer > const & base,
+        uint32_t const & area,
+        Mask const & directions,
+        uint64_t const & patches = ~0ull
+    )
         : buffer::data::ReadGuardBase< Buffer >( base )
         , area(area)
         , directions(directions)
+        , patches(patches)
     {}
 
     //! create read guard for exchange data
@@ -239,7 +260,8 @@ struct buffer::data::ReadGuard<
                     grid_buffer::data::Access{
                         rg::access::IOAccess::read,
                         this->area,
-                        this->directions
+                        this->directions,
+                        this->patches
                     }
                 )   
             });
@@ -247,7 +269,7 @@ struct buffer::data::ReadGuard<
 
     auto read() const noexcept
     {
-        return ReadGuard( *this, this->area, this->directions );
+        return ReadGuard( *this, this->area, this->directions, this->patches );
     }
 
     //! only reduces resource access, not memory offset
@@ -256,6 +278,7 @@ struct buffer::data::ReadGuard<
         auto n = typename Buffer::DataGuard( *this ).read();
         n.area = area;
         n.directions = this->directions;
+        n.patches = this->patches;
         return n;
     }
 
@@ -265,6 +288,17 @@ struct buffer::data::ReadGuard<
         auto n = typename Buffer::DataGuard( *this ).read();
         n.area = this->area;
         n.directions = directions;
+        n.patches = this->patches;
+        return n;
+    }
+
+    //! only reduces resource access to the given CORE patches, not memory offset
+    auto access_patches( uint64_t patches ) const
+    {
+        auto n = typename Buffer::DataGuard( *this ).read();
+        n.area = this->area;
+        n.directions = this->directions;
+        n.patches = patches;
         return n;
     }
 
@@ -294,6 +328,7 @@ struct buffer::data::WriteGuard<
 public:
     uint32_t area;
     Mask directions;
+    uint64_t patches = ~0ull;
 
     friend Buffer;
     friend class rg::trait::BuildProperties< WriteGuard >;
@@ -302,6 +337,7 @@ public:
         : buffer::data::WriteGuardBase< Buffer >( other )
         , area(other.area)
         , directions(other.directions)
+        , patches(other.patches)
     {}
 
     WriteGuard( GuardBase< Buffer > const & base )
@@ -312,10 +348,16 @@ public:
             this->directions = this->directions + Mask(i);
     }
 
-    WriteGuard( GuardBase< Buffer > const & base, uint32_t const & area, Mask const & directions )
+    WriteGuard(
+        GuardBase< Buffer > const & base,
+        uint32_t const & area,
+        Mask const & directions,
+        uint64_t const & patches = ~0ull
+    )
         : buffer::data::WriteGuardBase< Buffer >( base )
         , area(area)
         , directions(directions)
+        , patches(patches)
     {}
 
     //! create write guard for exchange data
@@ -353,7 +395,8 @@ public:
                     grid_buffer::data::Access{
                         rg::access::IOAccess::write,
                         this->area,
-                        this->directions
+                        this->directions,
+                        this->patches
                     }
                 )   
             });
@@ -361,12 +404,12 @@ public:
 
     auto read() const noexcept
     {
-        return buffer::data::ReadGuard< Buffer >( *this, this->area, this->directions );
+        return buffer::data::ReadGuard< Buffer >( *this, this->area, this->directions, this->patches );
     }
 
     auto write() const noexcept
     {
-        return WriteGuard( *this, this->area, this->directions );
+        return WriteGuard( *this, this->area, this->directions, this->patches );
     }
 
     //! only reduces resource access, not memory offset
@@ -377,6 +420,7 @@ public:
         typename Buffer::DataGuard n( *this );
         n.area = area;
         n.directions = this->directions;
+        n.patches = this->patches;
         return n;
     }
 
@@ -388,6 +432,17 @@ public:
         typename Buffer::DataGuard n( *this );
         n.area = this->area;
         n.directions = directions;
+        n.patches = this->patches;
+        return n;
+    }
+
+    //! only reduces resource access to the given CORE patches, not memory offset
+    auto access_patches( uint64_t patches ) const
+    {
+        typename Buffer::DataGuard n( *this );
+        n.area = this->area;
+        n.directions = this->directions;
+        n.patches = patches;
         return n;
     }
 
@@ -637,10 +692,11 @@ struct fmt::formatter< pmacc::mem::grid_buffer::data::Access >
 
         return format_to(
                    ctx.out(),
-                   "{{ \"GridAccess\" : {{ \"mode\" : {}, \"area\" : {}, \"directions\" : {} }} }}",
+                   "{{ \"GridAccess\" : {{ \"mode\" : {}, \"area\" : {}, \"directions\" : {}, \"patches\" : \"{:#x}\" }} }}",
                    a.mode,
                    area_str.str(),
-                   direction_str.str()
+                   direction_str.str(),
+                   a.patches
                );
     }
 };
@@ -25,6 +25,10 @@
 #include <pmacc/types.hpp>
 
 #include <memory>
+#include <mpi.h>
+
+#include <pmacc/communication/manager_common.hpp>
+#include <pmacc/traits/IsDeviceMemoryHostAccessible.hpp>
 
 #include <pmacc/dimensions/DataSpace.hpp>
 #include <pmacc/dimensions/GridLayout.hpp>
@@ -157,12 +161,71 @@ exchangeTypeToDataSpace(
     return tmp_size;
 }
 
+/**
+ * create an MPI datatype which describes the accessed area of a buffer
+ *
+ * The datatype is relative to the first element of the area
+ * (`guard.data().getPointer()`) and follows the pitch of the buffer,
+ * so the area can be sent and received in place.
+ *
+ * @param guard access to an area of a buffer
+ * @return committed datatype, freed with the last reference
+ */
+template< typename T_Guard >
+std::shared_ptr< MPI_Datatype >
+createAreaDatatype( T_Guard const & guard )
+{
+    constexpr std::size_t dim = T_Guard::dim;
+    using Item = typename T_Guard::Item;
+
+    DataSpace< dim > const size = guard.getDataSpace();
+
+    MPI_Datatype type;
+    MPI_CHECK( MPI_Type_contiguous( size[0] * sizeof( Item ), MPI_CHAR, &type ) );
+
+    if( dim > DIM1 )
+    {
+        MPI_Datatype rows;
+        MPI_CHECK( MPI_Type_create_hvector( size[1], 1, guard.getPitch(), type, &rows ) );
+        MPI_CHECK( MPI_Type_free( &type ) );
+        type = rows;
+    }
+    if( dim > DIM2 )
+    {
+        MPI_Aint const slicePitch = guard.getPitch() * guard.getCapacity()[ 1 ];
+        MPI_Datatype planes;
+        MPI_CHECK( MPI_Type_create_hvector( size[ dim - 1 ], 1, slicePitch, type, &planes ) );
+        MPI_CHECK( MPI_Type_free( &type ) );
+        type = planes;
+    }
+
+    MPI_CHECK( MPI_Type_commit( &type ) );
+
+    return std::shared_ptr< MPI_Datatype >(
+        new MPI_Datatype( type ),
+        []( MPI_Datatype * type )
+        {
+            int finalized;
+            MPI_CHECK_NO_EXCEPT( MPI_Finalized( &finalized ) );
+            if( !finalized )
+                MPI_CHECK_NO_EXCEPT( MPI_Type_free( type ) );
+            delete type;
+        }
+    );
+}
+
 } // namespace exchange
 
 struct Exchange
 {
     uint32_t exchangeType;
     uint32_t communicationTag;
+    /*! true if the message always has the capacity of the message buffer
+     *
+     * Fixed-size messages are sent with persistent requests,
+     * variable-size messages (e.g. particle stacks) with fresh requests.
+     */
+    bool fixedSize = false;
 
     /**
      * Returns the value used for tagging ('naming') communicated messages
@@ -179,24 +242,30 @@ struct Exchange
     {
         PMACC_ASSERT( messageBuffer.is1D() );
 
-        // need to create a task because the Communicator
-        // doesn't know about the resource
+        /* The communicator doesn't know about the resource, so the MPI task
+         * carries the buffer guard itself. While the request is in flight
+         * the task is suspended and the MPI scheduler completes it, dependent
+         * tasks are released without any worker thread waiting.
+         */
         Environment<>::task(
-            [=]( auto messageBuffer )
+            [ exchangeType = exchangeType, communicationTag = communicationTag, fixedSize = fixedSize ]( auto messageBuffer )
             {
-                size_t new_size = Environment<BufferResource::dim>::get()
+                auto & communicator = Environment<BufferResource::dim>::get()
                     .EnvironmentController()
-                    .getCommunicator()
-                    .recv(
-                        exchangeType,
-                        ( char * ) messageBuffer.data().getPointer(),
-                        messageBuffer.getDataSpace().productOfComponents() * sizeof(typename BufferResource::Item),
-                        communicationTag
-                    );
+                    .getCommunicator();
+
+                char * data = ( char * ) messageBuffer.data().getPointer();
+                size_t const bytes = messageBuffer.getDataSpace().productOfComponents() * sizeof(typename BufferResource::Item);
+
+                size_t new_size = fixedSize
+                    ? communicator.recvPersistent( exchangeType, data, bytes, communicationTag )
+                    : communicator.recv( exchangeType, data, bytes, communicationTag );
 
                 messageBuffer.size().set( new_size / sizeof(typename BufferResource::Item) );
             },
-            TaskProperties::Builder().label("Exchange::recv()"),
+            TaskProperties::Builder()
+                .label("Exchange::recv()")
+                .scheduling_tags({ SCHED_MPI }),
             messageBuffer.write()
         );
     }
@@ -206,25 +275,91 @@ struct Exchange
     {
         PMACC_ASSERT( messageBuffer.is1D() );
 
-        // need to create a task because the Communicator
-        // doesn't know about the resource
+        // MPI task which carries the buffer guard, see recvBuf()
         Environment<>::task(
-            [=]( auto messageBuffer )
+            [ exchangeType = exchangeType, communicationTag = communicationTag, fixedSize = fixedSize ]( auto messageBuffer )
             {
-                Environment<BufferResource::dim>::get()
+                auto & communicator = Environment<BufferResource::dim>::get()
                     .EnvironmentController()
-                    .getCommunicator()
-                    .send(
+                    .getCommunicator();
+
+                char const * data = ( char const* ) messageBuffer.data().getPointer();
+
+                if( fixedSize )
+                    communicator.sendPersistent(
                         exchangeType,
-                        ( char const* ) messageBuffer.data().getPointer(),
+                        data,
+                        messageBuffer.getDataSpace().productOfComponents() * sizeof(typename BufferResource::Item),
+                        communicationTag
+                    );
+                else
+                    communicator.send(
+                        exchangeType,
+                        data,
                         messageBuffer.size().get() * sizeof(typename BufferResource::Item),
                         communicationTag
                     );
             },
-            TaskProperties::Builder().label("Exchange::send()"),
+            TaskProperties::Builder()
+                .label("Exchange::send()")
+                .scheduling_tags({ SCHED_MPI }),
             messageBuffer.read()
         );
     }
+
+    /*! receive directly into a strided area of a buffer
+     *
+     * @param area access to the area, e.g. the guard of a field
+     * @param datatype datatype of the area, see exchange::createAreaDatatype()
+     */
+    template< typename BufferResource >
+    void recvArea(
+        buffer::WriteGuard< BufferResource > const & area,
+        std::shared_ptr< MPI_Datatype > datatype
+    )
+    {
+        // MPI task which carries the buffer guard, see recvBuf()
+        Environment<>::task(
+            [ exchangeType = exchangeType, communicationTag = communicationTag, datatype ]( auto area )
+            {
+                Environment<BufferResource::dim>::get()
+                    .EnvironmentController()
+                    .getCommunicator()
+                    .recvPersistent( exchangeType, area.data().getPointer(), *datatype, communicationTag );
+            },
+            TaskProperties::Builder()
+                .label("Exchange::recvArea()")
+                .scheduling_tags({ SCHED_MPI }),
+            area.write()
+        );
+    }
+
+    /*! send a strided area of a buffer without packing it
+     *
+     * @param area access to the area, e.g. the border of a field
+     * @param datatype datatype of the area, see exchange::createAreaDatatype()
+     */
+    template< typename BufferResource >
+    void sendArea(
+        buffer::ReadGuard< BufferResource > const & area,
+        std::shared_ptr< MPI_Datatype > datatype
+    )
+    {
+        // MPI task which carries the buffer guard, see recvBuf()
+        Environment<>::task(
+            [ exchangeType = exchangeType, communicationTag = communicationTag, datatype ]( auto area )
+            {
+                Environment<BufferResource::dim>::get()
+                    .EnvironmentController()
+                    .getCommunicator()
+                    .sendPersistent( exchangeType, area.data().getPointer(), *datatype, communicationTag );
+            },
+            TaskProperties::Builder()
+                .label("Exchange::sendArea()")
+                .scheduling_tags({ SCHED_MPI }),
+            area.read()
+        );
+    }
 };
 
 template <
@@ -242,11 +377,23 @@ struct ExchangeBuffer
         uint32_t exchangeType,
         uint32_t communicationTag,
         bool useMpiDirect,
-        bool sizeOnDevice
+        bool sizeOnDevice,
+        bool fixedSize = false
     ) :
-        Exchange{ exchangeType, communicationTag },
+        Exchange{ exchangeType, communicationTag, fixedSize },
         deviceBuffer( deviceBuffer )
     {
+        /* If the device memory is host memory (CPU accelerators), fixed-size
+         * exchanges are sent and received in place with an MPI datatype
+         * which describes the strided area. Neither a serialization buffer
+         * nor a host copy is needed.
+         */
+        if( fixedSize && ! useMpiDirect && traits::IsDeviceMemoryHostAccessible<>::value )
+        {
+            areaDatatype = exchange::createAreaDatatype( deviceBuffer );
+            return;
+        }
+
         if( T_dim > DIM1 )
             deviceDoubleBuffer.emplace( deviceBuffer.getDataSpace(), sizeOnDevice, true );
 
@@ -256,60 +403,84 @@ struct ExchangeBuffer
 
     void send()
     {
-        if( deviceDoubleBuffer )
+        if( areaDatatype )
+            // zero copy: send the border directly from the field
+            this->sendArea( deviceBuffer.read(), areaDatatype );
+        else if( hostBuffer )
         {
+            // send over host memory
+            packHost();
+            this->sendBuf( hostBuffer->read() );
+        }
+        else if( deviceDoubleBuffer )
+        {
+            // use mpi direct
             buffer::copy( deviceDoubleBuffer->write(), deviceBuffer.read() );
-
-            if( hostBuffer )
-            {
-                // send over host memory
-                buffer::copy( hostBuffer->write(), deviceDoubleBuffer->read() );
-                this->sendBuf( hostBuffer->read() );
-            }
-            else
-                // use mpi direct
-                this->sendBuf( deviceDoubleBuffer->read() );
+            this->sendBuf( deviceDoubleBuffer->read() );
         }
         else
+            // use mpi direct
+            this->sendBuf( deviceBuffer );
+    }
+
+    void recv()
+    {
+        if( areaDatatype )
+            this->recvArea( deviceBuffer, areaDatatype );
+        else if( hostBuffer )
         {
-            if( hostBuffer )
-            {
-                // send over host memory
-                buffer::copy( hostBuffer->write(), deviceBuffer.read() );
-                this->sendBuf( hostBuffer->read() );
-            }
-            else
-                // use mpi direct
-                this->sendBuf( deviceBuffer );
+            this->recvBuf( *hostBuffer );
+            unpackHost();
         }
+        else if( deviceDoubleBuffer )
+        {
+            this->recvBuf( deviceDoubleBuffer->write() );
+            buffer::copy( deviceBuffer.write(), deviceDoubleBuffer->read() );
+        }
+        else
+            this->recvBuf( deviceBuffer );
     }
 
-    void recv()
+    /*! copy the exchange data from the device into the host message buffer
+     *
+     * Only valid if the message is sent over host memory (see host()).
+     */
+    void packHost()
     {
         if( deviceDoubleBuffer )
         {
-            if( hostBuffer )
-            {
-                this->recvBuf( *hostBuffer );
-                buffer::copy( deviceDoubleBuffer->write(), hostBuffer->read() );
-            }
-            else
-                this->recvBuf( deviceDoubleBuffer->write() );
-
-            buffer::copy( deviceBuffer.write(), deviceDoubleBuffer->read() );
+            buffer::copy( deviceDoubleBuffer->write(), deviceBuffer.read() );
+            buffer::copy( hostBuffer->write(), deviceDoubleBuffer->read() );
         }
         else
+            buffer::copy( hostBuffer->write(), deviceBuffer.read() );
+    }
+
+    /*! copy a received host message buffer into the device exchange area
+     *
+     * Only valid if the message is received over host memory (see host()).
+     */
+    void unpackHost()
+    {
+        if( deviceDoubleBuffer )
         {
-            if( hostBuffer )
-            {
-                this->recvBuf( *hostBuffer );
-                buffer::copy( deviceBuffer.write(), hostBuffer->read() );
-            }
-            else
-                this->recvBuf( deviceBuffer );
+            buffer::copy( deviceDoubleBuffer->write(), hostBuffer->read() );
+            buffer::copy( deviceBuffer.write(), deviceDoubleBuffer->read() );
         }
+        else
+            buffer::copy( deviceBuffer.write(), hostBuffer->read() );
     }
 
+    /*! true if the exchange is sent in place from the device buffer
+     *
+     * In this case there is neither a host buffer nor a serialization
+     * buffer, see getAreaDatatype().
+     */
+    bool isZeroCopy() const { return bool( areaDatatype ); }
+
+    //! datatype of the exchange area, nullptr if the exchange is staged
+    std::shared_ptr< MPI_Datatype > getAreaDatatype() const { return areaDatatype; }
+
     auto host() const { return hostBuffer; }
     auto getHostBuffer() const { return hostBuffer; }
 
@@ -340,6 +511,9 @@ private:
             T_dim
         >
     > deviceDoubleBuffer;
+
+    //! datatype of the exchange area for zero copy exchanges
+    std::shared_ptr< MPI_Datatype > areaDatatype;
 };
 
 } // namespace mem
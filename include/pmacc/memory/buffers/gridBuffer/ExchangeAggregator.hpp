@@ -0,0 +1,325 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <pmacc/types.hpp>
+#include <pmacc/communication/manager_common.hpp>
+#include <pmacc/memory/buffers/GridBuffer.hpp>
+#include <pmacc/memory/buffers/HostBuffer.hpp>
+#include <pmacc/memory/buffers/gridBuffer/Exchange.hpp>
+#include <pmacc/memory/dataTypes/Mask.hpp>
+
+#include <array>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace pmacc
+{
+namespace mem
+{
+
+/*!
+ * Sends the exchanges of several GridBuffers in one message per neighbor.
+ *
+ * Each GridBuffer stages its exchange data in its own host buffers as in
+ * GridBuffer::communication(). The staged parts of all buffers for the same
+ * direction are packed into one contiguous host message, which is sent
+ * with a single MPI message. The receiver unpacks the message in the same
+ * order into the host buffers of its exchanges and copies them to the
+ * device. Pack and unpack are tasks which depend on the border/guard
+ * accesses of all participating buffers.
+ *
+ * Exchanges which are sent in place (CPU accelerators, see
+ * ExchangeBuffer::isZeroCopy()) are packed directly from the device buffer
+ * with their MPI datatype.
+ *
+ * Only exchanges with a fixed message size (e.g. field guards) can be
+ * aggregated, all ranks must add the same buffers in the same order.
+ * The buffers can still be communicated on their own with
+ * GridBuffer::communication(), both paths share the host staging buffers.
+ *
+ * @tparam T_dim dimension of the grid buffers
+ */
+template< std::size_t T_dim >
+class ExchangeAggregator
+{
+public:
+
+    /*!
+     * @param communicationTag unique tag/id for the aggregated messages,
+     *        must differ from the tags of the single GridBuffers
+     */
+    ExchangeAggregator( uint32_t communicationTag ) :
+        communicationTag( communicationTag )
+    {
+        for( uint32_t ex = 1; ex < 27; ++ex )
+        {
+            uint32_t const uniqCommunicationTag = getCommunicationTag( ex );
+            if( !privateGridBuffer::UniquTag::getInstance().isTagUniqu( uniqCommunicationTag ) )
+            {
+                std::stringstream message;
+                message << "unique exchange communication tag ("
+                    << uniqCommunicationTag << ") which is created from communicationTag ("
+                    << communicationTag << ") already used for other exchange";
+                throw std::runtime_error( message.str() );
+            }
+        }
+    }
+
+    /*!
+     * Add all exchanges of a GridBuffer.
+     *
+     * @param gridBuffer buffer with exchanges which are sent over host memory
+     */
+    template< typename T_Item, typename T_BorderItem >
+    void add( GridBuffer< T_Item, T_dim, T_BorderItem > & gridBuffer )
+    {
+        for( uint32_t ex = 1; ex < 27; ++ex )
+        {
+            if( auto exchange = gridBuffer.getSendExchange( ex ) )
+                addPart( sendParts[ ex ], *exchange, true );
+
+            if( auto exchange = gridBuffer.getReceiveExchange( ex ) )
+                addPart( recvParts[ ex ], *exchange, false );
+        }
+
+        // message buffers are allocated with the next communication
+        for( uint32_t ex = 1; ex < 27; ++ex )
+        {
+            sendMessages[ ex ].reset();
+            recvMessages[ ex ].reset();
+        }
+    }
+
+    /*!
+     * Exchange the data of all added GridBuffers with all neighbors.
+     */
+    void communication()
+    {
+        Mask const neighbors = Environment< T_dim >::get().EnvironmentController().getCommunicationMask();
+
+        for( uint32_t ex = 1; ex < 27; ++ex )
+            if( neighbors.isSet( ex ) && ! sendParts[ ex ].empty() )
+            {
+                auto & message = getMessage( sendMessages[ ex ], sendParts[ ex ] );
+
+                std::size_t offset = 0u;
+                for( auto & part : sendParts[ ex ] )
+                {
+                    part.transfer( message, offset );
+                    offset += part.bytes;
+                }
+
+                Exchange{ ex, getCommunicationTag( ex ), true }.sendBuf( message.read() );
+            }
+
+        for( uint32_t ex = 1; ex < 27; ++ex )
+            if( neighbors.isSet( ex ) && ! recvParts[ ex ].empty() )
+            {
+                auto & message = getMessage( recvMessages[ ex ], recvParts[ ex ] );
+
+                // the neighbor sends in the mirrored direction
+                Exchange{ ex, getCommunicationTag( Mask::getMirroredExchangeType( ex ) ), true }.recvBuf( message );
+
+                std::size_t offset = 0u;
+                for( auto & part : recvParts[ ex ] )
+                {
+                    part.transfer( message, offset );
+                    offset += part.bytes;
+                }
+            }
+    }
+
+private:
+
+    using Message = HostBuffer< char, DIM1 >;
+
+    //! exchange of one GridBuffer in one direction
+    struct Part
+    {
+        //! message size in bytes
+        std::size_t bytes;
+        //! emit the tasks which copy between the exchange and the message at an offset
+        std::function< void( Message &, std::size_t ) > transfer;
+    };
+
+    uint32_t getCommunicationTag( uint32_t ex ) const
+    {
+        return ( communicationTag << 5 ) | ex;
+    }
+
+    /*!
+     * @param parts parts of one direction
+     * @param exchange exchange of a GridBuffer
+     * @param isSend true if exchange sends data, false if it receives data
+     */
+    template< typename T_Exchange >
+    static void addPart( std::vector< Part > & parts, T_Exchange const & exchange, bool isSend )
+    {
+        if( exchange.isZeroCopy() )
+        {
+            addZeroCopyPart( parts, exchange, isSend );
+            return;
+        }
+
+        auto hostBuffer = exchange.host();
+        if( ! hostBuffer )
+            throw std::runtime_error( "ExchangeAggregator: exchanges must be sent over host memory or in place" );
+
+        using Item = typename std::decay_t< decltype( *hostBuffer ) >::Item;
+        std::size_t const bytes = hostBuffer->getDataSpace().productOfComponents() * sizeof( Item );
+
+        if( isSend )
+            parts.push_back( Part{
+                bytes,
+                [ exchange, bytes ]( Message & message, std::size_t offset ) mutable
+                {
+                    exchange.packHost();
+                    Environment<>::task(
+                        [ bytes, offset ]( auto message, auto part )
+                        {
+                            std::memcpy(
+                                ( char * ) message.data().getPointer() + offset,
+                                ( char const * ) part.data().getPointer(),
+                                bytes
+                            );
+                        },
+                        TaskProperties::Builder().label( "ExchangeAggregator::pack()" ),
+                        message.write(),
+                        exchange.host()->read()
+                    );
+                }
+            } );
+        else
+            parts.push_back( Part{
+                bytes,
+                [ exchange, bytes ]( Message & message, std::size_t offset ) mutable
+                {
+                    Environment<>::task(
+                        [ bytes, offset ]( auto message, auto part )
+                        {
+                            std::memcpy(
+                                ( char * ) part.data().getPointer(),
+                                ( char const * ) message.data().getPointer() + offset,
+                                bytes
+                            );
+                        },
+                        TaskProperties::Builder().label( "ExchangeAggregator::unpack()" ),
+                        message.read(),
+                        exchange.host()->write()
+                    );
+                    exchange.unpackHost();
+                }
+            } );
+    }
+
+    /*!
+     * Part of an exchange which is sent in place (see ExchangeBuffer::isZeroCopy()).
+     *
+     * The strided area is packed into the message with its MPI datatype,
+     * there is no host staging buffer. MPI_Pack()/MPI_Unpack() are
+     * executed by the MPI scheduler.
+     */
+    template< typename T_Exchange >
+    static void addZeroCopyPart( std::vector< Part > & parts, T_Exchange const & exchange, bool isSend )
+    {
+        std::shared_ptr< MPI_Datatype > datatype = exchange.getAreaDatatype();
+
+        int packSize;
+        MPI_CHECK( MPI_Pack_size( 1, *datatype, MPI_COMM_WORLD, &packSize ) );
+        std::size_t const bytes = packSize;
+
+        if( isSend )
+            parts.push_back( Part{
+                bytes,
+                [ exchange, datatype, bytes ]( Message & message, std::size_t offset )
+                {
+                    Environment<>::task(
+                        [ datatype, bytes, offset ]( auto message, auto area )
+                        {
+                            int position = 0;
+                            MPI_CHECK( MPI_Pack(
+                                area.data().getPointer(), 1, *datatype,
+                                ( char * ) message.data().getPointer() + offset, bytes,
+                                &position, MPI_COMM_WORLD
+                            ) );
+                        },
+                        TaskProperties::Builder()
+                            .label( "ExchangeAggregator::pack()" )
+                            .scheduling_tags( { SCHED_MPI } ),
+                        message.write(),
+                        exchange.device().read()
+                    );
+                }
+            } );
+        else
+            parts.push_back( Part{
+                bytes,
+                [ exchange, datatype, bytes ]( Message & message, std::size_t offset )
+                {
+                    Environment<>::task(
+                        [ datatype, bytes, offset ]( auto message, auto area )
+                        {
+                            int position = 0;
+                            MPI_CHECK( MPI_Unpack(
+                                ( char * ) message.data().getPointer() + offset, bytes,
+                                &position, area.data().getPointer(), 1, *datatype,
+                                MPI_COMM_WORLD
+                            ) );
+                        },
+                        TaskProperties::Builder()
+                            .label( "ExchangeAggregator::unpack()" )
+                            .scheduling_tags( { SCHED_MPI } ),
+                        message.read(),
+                        exchange.device().write()
+                    );
+                }
+            } );
+    }
+
+    //! message buffer which holds all parts of one direction
+    static Message & getMessage( std::optional< Message > & message, std::vector< Part > const & parts )
+    {
+        if( ! message )
+        {
+            std::size_t bytes = 0u;
+            for( auto const & part : parts )
+                bytes += part.bytes;
+            message.emplace( DataSpace< DIM1 >( bytes ) );
+        }
+        return *message;
+    }
+
+    uint32_t communicationTag;
+
+    std::array< std::vector< Part >, 27 > sendParts, recvParts;
+    std::array< std::optional< Message >, 27 > sendMessages, recvMessages;
+};
+
+} // namespace mem
+} // namespace pmacc
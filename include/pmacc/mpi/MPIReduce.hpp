@@ -25,6 +25,7 @@
 #include "pmacc/mpi/reduceMethods/AllReduce.hpp"
 #include "pmacc/mpi/GetMPI_StructAsArray.hpp"
 #include "pmacc/mpi/GetMPI_Op.hpp"
+#include "pmacc/type/AsyncResult.hpp"
 #include "pmacc/assert.hpp"
 #include "pmacc/types.hpp"
 
@@ -89,7 +90,7 @@ struct MPIReduce
         /*free old communicator of init is called again*/
 
         Environment<>::task(
-                            [this, isActive]
+                            [this, isActive]( auto )
                             {
 
         if (isMPICommInitialized)
@@ -139,7 +140,8 @@ struct MPIReduce
         MPI_CHECK(MPI_Group_free(&newgroup));
 
             },
-            TaskProperties::Builder().scheduling_tags({SCHED_MPI})
+            TaskProperties::Builder().scheduling_tags({SCHED_MPI}),
+            collectiveOrder.write()
         ).get();
     }
 
@@ -166,7 +168,7 @@ struct MPIReduce
         typedef Type ValueType;
 
         Environment<>::task(
-                            [func, dest, src, n, method, comm = this->comm]
+                            [func, dest, src, n, method, comm = this->comm]( auto )
                             {
         method(func,
                dest,
@@ -177,7 +179,8 @@ struct MPIReduce
                comm);
         
                             },
-                            TaskProperties::Builder().scheduling_tags({ SCHED_MPI }).label("MPI Reduce Method")
+                            TaskProperties::Builder().scheduling_tags({ SCHED_MPI }).label("MPI Reduce Method"),
+                            collectiveOrder.write()
         ).get();
     }
 
@@ -203,9 +206,63 @@ struct MPIReduce
         this->operator ()(func, dest, src, n, ::pmacc::mpi::reduceMethods::AllReduce());
     }
 
+    /* Reduce elements on cpu memory without waiting for the result
+     *
+     * The reduction is started with a non-blocking collective as soon as
+     * @p src is written. No thread waits for the collective, the task is
+     * suspended until the MPI scheduler detects the completion.
+     * Call hasResult to see if the result is valid on this rank.
+     *
+     * @param func binary functor for reduce, must specialize the function getMPI_Op.
+     * @param src values to reduce, e.g. the result of nvidia::reduce::Reduce::async()
+     * @param method mpi method for reduce
+     *
+     * @return reduced values, same number of elements as @p src
+     */
+    template<class Functor, typename Type, class ReduceMethod = ::pmacc::mpi::reduceMethods::AllReduce >
+    HINLINE AsyncResult< Type > async(Functor func,
+                                      AsyncResult< Type > const & src,
+                                      const ReduceMethod method = ReduceMethod())
+    {
+        if (!isMPICommInitialized)
+            participate(true);
+
+        AsyncResult< Type > dest( src.size() );
+
+        Environment<>::task(
+            [func, method, n = src.size(), comm = this->comm]( auto dest, auto src, auto )
+            {
+                MPI_Request request = method.start(
+                    func,
+                    dest->data(),
+                    src->data(),
+                    n * ::pmacc::mpi::getMPI_StructAsArray< Type >().sizeMultiplier,
+                    ::pmacc::mpi::getMPI_StructAsArray< Type >().dataType,
+                    ::pmacc::mpi::getMPI_Op< Functor >(),
+                    comm
+                );
+
+                Environment<>::get().mpi_request_pool()->get_status( request );
+            },
+            TaskProperties::Builder()
+                .label("MPIReduce::async()")
+                .scheduling_tags({ SCHED_MPI }),
+            dest.write(),
+            src.read(),
+            collectiveOrder.write()
+        );
+
+        return dest;
+    }
 
 private:
 
+    /* Collectives must be started in the same order on all ranks.
+     * Every task which uses comm writes this resource, so the tasks
+     * start their collectives in the order of their submission.
+     */
+    rg::IOResource< int > collectiveOrder{ 0 };
+
     MPI_Comm comm;
     int mpiRank;
     int numRanks;
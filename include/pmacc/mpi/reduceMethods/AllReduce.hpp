@@ -52,6 +52,22 @@ struct AllReduce
                                 type,
                                 op, comm));
     }
+
+    /** start a non-blocking reduction
+     *
+     * @return request which is finished as soon as @p dest is valid
+     */
+    template<class Functor, typename Type >
+    HINLINE MPI_Request start(Functor, Type* dest, Type const * src, const size_t count, MPI_Datatype type, MPI_Op op, MPI_Comm comm) const
+    {
+        MPI_Request request;
+        MPI_CHECK(MPI_Iallreduce((void*) src,
+                                 (void*) dest,
+                                 count,
+                                 type,
+                                 op, comm, &request));
+        return request;
+    }
 };
 
 } /*namespace reduceMethods*/
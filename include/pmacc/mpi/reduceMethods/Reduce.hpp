@@ -53,6 +53,22 @@ struct Reduce
                              type,
                              op, 0, comm));
     }
+
+    /** start a non-blocking reduction
+     *
+     * @return request which is finished as soon as @p dest is valid
+     */
+    template<class Functor, typename Type >
+    HINLINE MPI_Request start(Functor, Type* dest, Type const * src, const size_t count, MPI_Datatype type, MPI_Op op, MPI_Comm comm) const
+    {
+        MPI_Request request;
+        MPI_CHECK(MPI_Ireduce((void*) src,
+                              (void*) dest,
+                              count,
+                              type,
+                              op, 0, comm, &request));
+        return request;
+    }
 };
 
 } /*namespace reduceMethods*/
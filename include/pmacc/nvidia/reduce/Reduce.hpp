@@ -27,6 +27,7 @@
 #include "pmacc/traits/GetValueType.hpp"
 #include "pmacc/types.hpp"
 #include "pmacc/memory/buffers/GridBuffer.hpp"
+#include "pmacc/type/AsyncResult.hpp"
 #include "pmacc/traits/GetNumWorkers.hpp"
 #include "pmacc/memory/CtxArray.hpp"
 #include "pmacc/mappings/threads/ForEachIdx.hpp"
@@ -312,6 +313,8 @@ namespace kernel
         }
 
         /* Reduce elements in global gpu memory
+         *
+         * Waits until the reduced value is available, see async().
          *
          * @param func binary functor for reduce which takes two arguments, first argument is the source and get the new reduced value.
          * Functor must specialize the function getMPI_Op.
@@ -323,7 +326,24 @@ namespace kernel
         template<class Functor, typename Src>
         HINLINE typename traits::GetValueType<Src>::ValueType operator()(Functor func, Src src, uint32_t n)
         {
-            
+            return async(func, src, n).get();
+        }
+
+        /* Reduce elements in global gpu memory without waiting for the result
+         *
+         * @param func binary functor for reduce which takes two arguments, first argument is the source and get the new reduced value.
+         * Functor must specialize the function getMPI_Op.
+         * @param src a class or a pointer where the reduce algorithm can access the value by operator [] (one dimensional access)
+         * @param n number of elements to reduce
+         * @param srcGuards resource guards of the memory accessed by @p src,
+         *        the reduction is ordered after all tasks writing this memory
+         *
+         * @return AsyncResult with one element, written by the last task of the reduction
+         */
+        template<class Functor, typename Src, typename ... T_SrcGuards>
+        HINLINE auto async(Functor func, Src src, uint32_t n, T_SrcGuards const & ... srcGuards)
+        {
+
            /* - the result of a functor can be a reference or a const value
             * - it is not allowed to create const or reference memory
             *   thus we remove `references` and `const` qualifiers */
@@ -334,7 +354,7 @@ namespace kernel
                    >::type Type;
 
             Environment<>::task(
-                [this, func, src, n]( auto deviceData ) mutable
+                [this, func, src, n]( auto deviceData, auto && ... ) mutable
                 {
                     uint32_t blockcount = optimalThreadsPerBlock(n, sizeof (Type));
 
@@ -435,19 +455,24 @@ namespace kernel
                 TaskProperties::Builder()
                     .label("reduce kernels"),
 
-                reduceBuffer->device().data()
+                reduceBuffer->device().data(),
+                srcGuards...
             );
 
             reduceBuffer->deviceToHost();
 
-            return Environment<>::task(
-                       []( auto hostData )
-                       {
-                           return *((Type*) (hostData.getBasePointer()));
-                       },
-                       TaskProperties::Builder().label("read reduceBuffer"),
-                       reduceBuffer->host().data().read()
-                   ).get();
+            AsyncResult< Type > result;
+            Environment<>::task(
+                []( auto hostData, auto result )
+                {
+                    ( *result )[ 0 ] = *((Type*) (hostData.getBasePointer()));
+                },
+                TaskProperties::Builder().label("read reduceBuffer"),
+                reduceBuffer->host().data().read(),
+                result.write()
+            );
+
+            return result;
         }
 
         virtual ~Reduce()
@@ -28,6 +28,8 @@
 #include "pmacc/memory/buffers/HostDeviceBuffer.hpp"
 #include "pmacc/debug/PMaccVerbose.hpp"
 
+#include <atomic>
+
 namespace pmacc
 {
 
@@ -35,6 +37,41 @@ namespace pmacc
 
         DEVICEONLY uint64_cu nextId;
 
+#if !( BOOST_LANG_CUDA || BOOST_COMP_HIP )
+        /** number of ids reserved at once by a worker of a CPU accelerator
+         *
+         * Each worker hands out the ids of its range without touching the
+         * shared counter nextId, which is only incremented once per range.
+         */
+        constexpr uint64_t rangeSize = 256u;
+
+        //! ids reserved by a worker
+        struct IdRange
+        {
+            //! generation of the IdProvider state the range belongs to
+            uint64_t generation = 0u;
+            uint64_t next = 0u;
+            uint64_t end = 0u;
+        };
+
+        /** generation of the IdProvider state
+         *
+         * Incremented on each change of nextId from the host, which drops the
+         * ranges reserved before.
+         */
+        inline std::atomic< uint64_t > & stateGeneration()
+        {
+            static std::atomic< uint64_t > generation{ 1u };
+            return generation;
+        }
+
+        inline IdRange & workerIdRange()
+        {
+            thread_local IdRange range;
+            return range;
+        }
+#endif
+
         struct KernelSetNextId
         {
             template<typename T_Acc>
@@ -136,7 +173,22 @@ namespace pmacc
     template<unsigned T_dim>
     HDINLINE uint64_t IdProvider<T_dim>::getNewId()
     {
+#if( BOOST_LANG_CUDA || BOOST_COMP_HIP )
+        // the increments of a warp are aggregated to one atomic operation
         return static_cast<uint64_t>(nvidia::atomicAllInc(&idDetail::nextId));
+#else
+        idDetail::IdRange & range = idDetail::workerIdRange();
+        uint64_t const generation = idDetail::stateGeneration().load(std::memory_order_acquire);
+        if(range.next == range.end || range.generation != generation)
+        {
+            range.next = static_cast<uint64_t>(
+                __atomic_fetch_add(&idDetail::nextId, idDetail::rangeSize, __ATOMIC_RELAXED)
+            );
+            range.end = range.next + idDetail::rangeSize;
+            range.generation = generation;
+        }
+        return range.next++;
+#endif
     }
 
     template<unsigned T_dim>
@@ -195,6 +247,10 @@ namespace pmacc
             [ nextId ]()
             {
                 PMACC_KERNEL(idDetail::KernelSetNextId{})(1, 1)(nextId);
+#if !( BOOST_LANG_CUDA || BOOST_COMP_HIP )
+                // ranges reserved from the previous counter must not be used
+                idDetail::stateGeneration()++;
+#endif
             },
             TaskProperties::Builder()
                 .label("KernelSetNextId")
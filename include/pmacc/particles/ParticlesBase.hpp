@@ -85,6 +85,9 @@ public:
         TileSize = math::CT::volume<typename MappingDesc::SuperCellSize>::type::value
     };
 
+    /* supercells with more frames are only gap-filled by sortParticles() */
+    static constexpr uint32_t maxSortFrames = 64u;
+
     /* Mark this simulation data as a particle type
      */
     typedef ParticlesTag SimulationDataTag;
@@ -179,6 +182,82 @@ public:
         this->fillGaps < BORDER > ();
     }
 
+    /* sort the particles of each supercell in an AREA by their cell index
+     *
+     * All gaps in the AREA are filled, too.
+     * @tparam AREA area which is used (CORE,BORDER,GUARD or a combination)
+     */
+    template< uint32_t AREA >
+    void sortParticles()
+    {
+        Environment<>::task(
+            [ cellDescription=this->cellDescription ]( auto parDevice )
+            {
+                AreaMapping< AREA, MappingDesc > mapper( cellDescription );
+
+                constexpr uint32_t numWorkers = traits::GetNumWorkers<
+                    math::CT::volume<typename FrameType::SuperCellSize>::type::value
+                >::value;
+
+                PMACC_KERNEL(KernelSortParticles< numWorkers, maxSortFrames >{})
+                    (mapper.getGridDim(), numWorkers)
+                    (parDevice.getParticlesBox(), mapper);
+            },
+            TaskProperties::Builder()
+                .label("sortParticles")
+                .scheduling_tags({ SCHED_CUPLA }),
+            particlesBuffer.device()
+        );
+    }
+
+    /* measure the disorder of the particles in an AREA
+     *
+     * @tparam AREA area which is used (CORE,BORDER,GUARD or a combination)
+     * @return fraction of the pairs of neighboring particles in a frame
+     *         which are not ordered by cell index, in [0;1]
+     */
+    template< uint32_t AREA >
+    double getDisorder()
+    {
+        // number of pairs, number of unordered pairs
+        mem::GridBuffer<
+            uint64_cu,
+            DIM1
+        > counter( DataSpace< DIM1 >( 2 ) );
+
+        Environment<>::task(
+            [ cellDescription=this->cellDescription ]( auto parDevice, auto counterDevice )
+            {
+                AreaMapping< AREA, MappingDesc > mapper( cellDescription );
+
+                constexpr uint32_t numWorkers = traits::GetNumWorkers<
+                    math::CT::volume<typename FrameType::SuperCellSize>::type::value
+                >::value;
+
+                PMACC_KERNEL(KernelParticleDisorder< numWorkers >{})
+                    (mapper.getGridDim(), numWorkers)
+                    (parDevice.getParticlesBox(), counterDevice.getBasePointer(), mapper);
+            },
+            TaskProperties::Builder()
+                .label("getDisorder")
+                .scheduling_tags({ SCHED_CUPLA }),
+            particlesBuffer.device(),
+            counter.device().data().write()
+        );
+
+        mem::buffer::copy( counter.host().write(), counter.device().read() );
+
+        return Environment<>::task(
+                   []( auto counterData )
+                   {
+                       auto const box = counterData.getDataBox();
+                       return box[0] == 0u ? 0.0 : double( box[1] ) / double( box[0] );
+                   },
+                   TaskProperties::Builder().label("read particle disorder"),
+                   counter.host().data().read()
+               ).get();
+    }
+
     /* Delete all particles in GUARD for one direction.
      */
     void deleteGuardParticles(uint32_t exchangeType);
@@ -212,6 +291,9 @@ public:
     /* set all internal objects to initial state*/
     virtual void reset(uint32_t currentStep);
 
+    /* delete all particles and reset the device objects only */
+    virtual void resetDevice(uint32_t currentStep);
+
 };
 
 } //namespace pmacc
@@ -96,6 +96,13 @@ namespace pmacc
         particlesBuffer.reset( );
     }
 
+    template<typename T_ParticleDescription, class MappingDesc, typename T_DeviceHeap>
+    void ParticlesBase<T_ParticleDescription, MappingDesc, T_DeviceHeap>::resetDevice(uint32_t )
+    {
+        deleteParticlesInArea<CORE+BORDER+GUARD>();
+        particlesBuffer.resetDevice( );
+    }
+
     template<typename T_ParticleDescription, class MappingDesc, typename T_DeviceHeap>
     void ParticlesBase<T_ParticleDescription, MappingDesc, T_DeviceHeap>::copyGuardToExchange( uint32_t exchangeType )
     {
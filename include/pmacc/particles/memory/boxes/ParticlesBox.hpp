@@ -33,6 +33,38 @@
 
 namespace pmacc
 {
+namespace detail
+{
+    /** allocate memory for a frame from the heap
+     *
+     * The heap handle `int` is used if there is no heap, frames are created
+     * with `new`.
+     */
+    template< typename T_Frame, typename T_Acc, typename T_DeviceHeapHandle >
+    DINLINE T_Frame* allocateFrame( T_Acc const & acc, T_DeviceHeapHandle & deviceHeapHandle )
+    {
+        return (T_Frame*) deviceHeapHandle.malloc( acc, sizeof( T_Frame ) );
+    }
+
+    template< typename T_Frame, typename T_Acc >
+    DINLINE T_Frame* allocateFrame( T_Acc const &, int & )
+    {
+        return new T_Frame;
+    }
+
+    //! release a frame allocated with allocateFrame()
+    template< typename T_Frame, typename T_Acc, typename T_DeviceHeapHandle >
+    DINLINE void releaseFrame( T_Acc const & acc, T_DeviceHeapHandle & deviceHeapHandle, T_Frame* frame )
+    {
+        deviceHeapHandle.free( acc, (void*) frame );
+    }
+
+    template< typename T_Frame, typename T_Acc >
+    DINLINE void releaseFrame( T_Acc const &, int &, T_Frame* frame )
+    {
+        delete frame;
+    }
+} // namespace detail
 
 /**
  * A DIM-dimensional Box holding frames with particle data.
@@ -97,11 +129,7 @@ public:
         const int maxTries = 13; //magic number is not performance critical
         for ( int numTries = 0; numTries < maxTries; ++numTries )
         {
-#if( BOOST_LANG_CUDA || BOOST_COMP_HIP)
-            tmp = (FrameType*) m_deviceHeapHandle.malloc( acc, sizeof (FrameType) );
-#else
-            tmp = new FrameType;
-#endif
+            tmp = detail::allocateFrame< FrameType >( acc, m_deviceHeapHandle );
             if ( tmp != nullptr )
             {
                 /* disable all particles since we can not assume that newly allocated memory contains zeros */
@@ -135,11 +163,7 @@ public:
     template<typename T_Acc>
     DINLINE void removeFrame( const T_Acc & acc, FramePtr& frame )
     {
-#if( BOOST_LANG_CUDA || BOOST_COMP_HIP)
-        m_deviceHeapHandle.free( acc, (void*) frame.ptr );
-#else
-        delete(frame.ptr);
-#endif
+        detail::releaseFrame( acc, m_deviceHeapHandle, frame.ptr );
         frame.ptr = nullptr;
     }
 
@@ -23,6 +23,7 @@
 
 
 #include "pmacc/dataManagement/ISimulationData.hpp"
+#include "pmacc/memory/FramePool.hpp"
 
 #include <mallocMC/mallocMC.hpp>
 
@@ -30,6 +31,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace pmacc
 {
@@ -62,11 +64,59 @@ namespace pmacc
         void synchronize() override;
 
     private:
+        /** regions of the heap sorted by address
+         *
+         * @throw std::runtime_error if there are gaps between the regions,
+         *        one offset could not translate all frame pointers
+         */
+        static std::vector< mallocMC::HeapInfo > getContiguousHeapLocations( DeviceHeap & deviceHeap );
+
+        /** host copy of all heap regions
+         *
+         * The regions are contiguous, therefore one offset translates all
+         * frame pointers.
+         */
         rg::IOResource< char > hostData; // is a shared_ptr< char >
         rg::IOResource< int64_t > hostBufferOffset;
-        rg::IOResource< mallocMC::HeapInfo > deviceHeapInfo;
+        rg::IOResource< std::vector< mallocMC::HeapInfo > > deviceHeapInfos;
     };
 
+    /** host view of a FramePool heap
+     *
+     * The frames of a FramePool are in host memory, the device pointers are
+     * valid on the host and nothing needs to be copied.
+     */
+    template< >
+    class MallocMCBuffer< memory::FramePool > : public ISimulationData
+    {
+    public:
+        using DeviceHeap = memory::FramePool;
+
+        MallocMCBuffer( const std::shared_ptr<DeviceHeap>& )
+        {
+        }
+
+        virtual ~MallocMCBuffer() {}
+
+        SimulationDataId getUniqueId() override
+        {
+            return getName();
+        }
+
+        static std::string getName()
+        {
+            return std::string("MallocMCBuffer");
+        }
+
+        int64_t getOffset()
+        {
+            return 0;
+        }
+
+        void synchronize() override
+        {
+        }
+    };
 
 } // namespace pmacc
 
@@ -24,7 +24,11 @@
 #include "pmacc/particles/memory/buffers/MallocMCBuffer.hpp"
 #include "pmacc/types.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
 
 
 namespace pmacc
@@ -32,18 +36,46 @@ namespace pmacc
 
 template< typename T_DeviceHeap >
 MallocMCBuffer< T_DeviceHeap >::MallocMCBuffer( const std::shared_ptr<DeviceHeap>& deviceHeap ) :
-    hostData( std::shared_ptr< char >( nullptr ) )
-    /* currently mallocMC has only one heap */
-    deviceHeapInfo( deviceHeap->getHeapLocations( )[ 0 ] ),
-    hostBufferOffset( 0 )
+    hostData( std::shared_ptr< char >( nullptr ) ),
+    hostBufferOffset( 0 ),
+    deviceHeapInfos( getContiguousHeapLocations( *deviceHeap ) )
 {
 }
 
+template< typename T_DeviceHeap >
+std::vector< mallocMC::HeapInfo > MallocMCBuffer< T_DeviceHeap >::getContiguousHeapLocations( DeviceHeap & deviceHeap )
+{
+    std::vector< mallocMC::HeapInfo > heapInfos = deviceHeap.getHeapLocations( );
+    if( heapInfos.empty( ) )
+        throw std::runtime_error( "MallocMCBuffer: the mallocMC heap has no regions" );
+
+    std::sort(
+        heapInfos.begin( ),
+        heapInfos.end( ),
+        []( mallocMC::HeapInfo const & a, mallocMC::HeapInfo const & b )
+        {
+            return reinterpret_cast< char * >( a.p ) < reinterpret_cast< char * >( b.p );
+        }
+    );
+
+    for( size_t i = 1u; i < heapInfos.size( ); ++i )
+        if( reinterpret_cast< char * >( heapInfos[ i - 1u ].p ) + heapInfos[ i - 1u ].size !=
+            reinterpret_cast< char * >( heapInfos[ i ].p ) )
+        {
+            std::stringstream msg;
+            msg << "MallocMCBuffer: the regions of the mallocMC heap are not contiguous, region "
+                << i << " does not start at the end of region " << ( i - 1u );
+            throw std::runtime_error( msg.str( ) );
+        }
+
+    return heapInfos;
+}
+
 template< typename T_DeviceHeap >
 void MallocMCBuffer< T_DeviceHeap >::synchronize( )
 {
     Environment<>::task(
-        []( auto hostData, auto hostBufferOffset, auto deviceHeapInfo )
+        []( auto hostData, auto hostBufferOffset, auto deviceHeapInfos )
         {
             /** \todo: we had no abstraction to create a host buffer and a pseudo
              *         device buffer (out of the mallocMC ptr) and copy both with our event
@@ -52,20 +84,26 @@ void MallocMCBuffer< T_DeviceHeap >::synchronize( )
              */
             if ( hostData.get() == nullptr )
             {
+                // the regions are sorted and contiguous, see getContiguousHeapLocations()
+                char * const heapBegin = reinterpret_cast< char * >( deviceHeapInfos->front( ).p );
+                size_t heapSize = 0u;
+                for( auto const & heapInfo : *deviceHeapInfos )
+                    heapSize += heapInfo.size;
+
                 /* use `new` and than `cudaHostRegister` is faster than `cudaMallocHost`
                  * but with the some result (create page-locked memory)
                  */
-                char * hostPtr = new char[ deviceHeapInfo->size ];
+                char * hostPtr = new char[ heapSize ];
                 CUDA_CHECK((cuplaError_t)
                     cudaHostRegister(
                         hostPtr,
-                        deviceHeapInfo->size,
+                        heapSize,
                         cudaHostRegisterDefault
                     ));
 
-		// this member access doesn't look good...
-		hostData.obj
-		    .reset(
+                // this member access doesn't look good...
+                hostData.obj
+                    .reset(
                         hostPtr,
                         []( char * hostPtr )
                         {
@@ -74,19 +112,20 @@ void MallocMCBuffer< T_DeviceHeap >::synchronize( )
                         }
                     );
 
-                *hostBufferOffset = static_cast<int64_t>(reinterpret_cast<char*>(deviceHeapInfo->p) - hostPtr);
+                *hostBufferOffset = static_cast<int64_t>(heapBegin - hostPtr);
             }
 
             Environment<>::task(
-                []( auto hostData, auto deviceHeapInfo )
+                []( auto hostData, auto hostBufferOffset, auto deviceHeapInfos )
                 {
-                    CUDA_CHECK(cuplaMemcpyAsync(
-                        hostData.get(),
-                        deviceHeapInfo->p,
-                        deviceHeapInfo->size,
-                        cuplaMemcpyDeviceToHost,
-                        redGrapes::thread::current_cupla_stream
-                    ));
+                    for( auto const & heapInfo : *deviceHeapInfos )
+                        CUDA_CHECK(cuplaMemcpyAsync(
+                            reinterpret_cast< char * >( heapInfo.p ) - *hostBufferOffset,
+                            heapInfo.p,
+                            heapInfo.size,
+                            cuplaMemcpyDeviceToHost,
+                            redGrapes::thread::current_cupla_stream
+                        ));
                 },
 
                 TaskProperties::Builder()
@@ -94,18 +133,18 @@ void MallocMCBuffer< T_DeviceHeap >::synchronize( )
                     .scheduling_tags({ SCHED_CUPLA }),
 
                 hostData.write(),
-		deviceHeapInfo.read()
+                hostBufferOffset.read(),
+                deviceHeapInfos.read()
            );
-	},
+        },
 
         TaskProperties::Builder()
             .label("MallocMCBuffer::synchronize()"),
 
-	hostData.write(),
-	hostBufferOffset.write(),
-	deviceHeapInfo.read()
+        hostData.write(),
+        hostBufferOffset.write(),
+        deviceHeapInfos.read()
     );
 }
 
 } // namespace pmacc
-
@@ -43,6 +43,7 @@
 #include "pmacc/particles/memory/frames/Frame.hpp"
 #include "pmacc/particles/Identifier.hpp"
 #include "pmacc/particles/memory/dataTypes/StaticArray.hpp"
+#include "pmacc/particles/storage/AttributeStorage.hpp"
 #include <boost/mpl/vector.hpp>
 #include <boost/mpl/pair.hpp>
 #include "pmacc/particles/ParticleDescription.hpp"
@@ -75,6 +76,9 @@ class ParticlesBuffer
 public:
 
     /** create static array
+     *
+     * The storage of an attribute is selected by the species flag
+     * `attributeStorage<>`, a plain StaticArray is used by default.
      */
     template< uint32_t T_size >
     struct OperatorCreatePairStaticArray
@@ -83,12 +87,18 @@ public:
         template<typename X>
         struct apply
         {
+            typedef typename particles::storage::GetAttributeStorage<
+                typename T_ParticleDescription::FlagsList,
+                X
+            >::type Storage;
+
             typedef bmpl::pair<
                 X,
-                StaticArray<
+                typename particles::storage::MakeStorageArray<
+                    Storage,
                     typename traits::Resolve<X>::type::type,
                     bmpl::integral_c<uint32_t, T_size>
-                >
+                >::type
             > type;
         };
     };
@@ -232,6 +242,14 @@ public:
         mem::buffer::fill( superCells.host(), SuperCellType() );
     }
 
+    /**
+     * Resets the device buffers, the host buffers are left unchanged.
+     */
+    void resetDevice()
+    {
+        mem::buffer::fill( superCells.device(), SuperCellType() );
+    }
+
     /**
      * Adds an exchange buffer to frames.
      *
@@ -396,7 +414,28 @@ struct DeviceGuard : private ParticlesBuffer<T_ParticleDescription, T_SuperCellS
     using typename ParticlesBuffer<T_ParticleDescription, T_SuperCellSize, T_DeviceHeap, T_dim>::ParticlesBoxType;
 
     DeviceGuard(ParticlesBuffer<T_ParticleDescription, T_SuperCellSize, T_DeviceHeap, T_dim> const & b)
-        : ParticlesBuffer<T_ParticleDescription, T_SuperCellSize, T_DeviceHeap, T_dim>(b) {}
+        : ParticlesBuffer<T_ParticleDescription, T_SuperCellSize, T_DeviceHeap, T_dim>(b)
+        , area{ CORE + BORDER + GUARD }
+    {
+        for( int i=1; i < 27; ++i)
+            this->directions = this->directions + Mask(i);
+    }
+
+    //! only reduces resource access, the particles box still covers all supercells
+    DeviceGuard access_dataPlace( uint32_t area ) const
+    {
+        DeviceGuard n( *this );
+        n.area = area;
+        return n;
+    }
+
+    //! only reduces resource access, the particles box still covers all supercells
+    DeviceGuard access_directions( Mask directions ) const
+    {
+        DeviceGuard n( *this );
+        n.directions = directions;
+        return n;
+    }
 
     /**
      * Returns a ParticlesBox for device frame data.
@@ -410,6 +449,12 @@ struct DeviceGuard : private ParticlesBuffer<T_ParticleDescription, T_SuperCellS
             this->m_deviceHeap->getAllocatorHandle()
         );
     }
+
+private:
+    //! supercells accessed by the task (CORE, BORDER, GUARD or a combination)
+    uint32_t area;
+    //! directions of the accessed BORDER and GUARD supercells
+    Mask directions;
 };
 
 } // namespace particles_buffer
@@ -443,7 +488,11 @@ struct redGrapes::trait::BuildProperties<
         pmacc::particles_buffer::DeviceGuard<T_ParticleDescription, T_SuperCellSize, T_DeviceHeap, T_dim> const& buf
     )
     {
-        builder.add( buf.superCells.device().data() );
+        builder.add(
+            buf.superCells.device().data()
+                .access_dataPlace( buf.area )
+                .access_directions( buf.directions )
+        );
     }
 };
 
@@ -0,0 +1,149 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+#include "pmacc/static_assert.hpp"
+
+#include <type_traits>
+
+
+namespace pmacc
+{
+
+    /** reference to an attribute with the same value for all particles
+     *
+     * Reads return the value of T_ValueFunctor. Writes are rejected at
+     * compile time, the value is defined by the species.
+     */
+    template<
+        typename T_Value,
+        typename T_ValueFunctor
+    >
+    class ConstantReference
+    {
+    public:
+        HDINLINE operator T_Value() const
+        {
+            return T_ValueFunctor{}();
+        }
+
+        ConstantReference & operator=( ConstantReference const & ) = delete;
+
+        template< typename T_Other >
+        HDINLINE ConstantReference & operator=( T_Other const & )
+        {
+            PMACC_CASSERT_MSG_TYPE(
+                a_constant_particle_attribute_can_not_be_written,
+                T_Other,
+                sizeof( T_Other ) == 0u
+            );
+            return *this;
+        }
+
+        template< typename T_Other >
+        HDINLINE ConstantReference & operator+=( T_Other const & other )
+        {
+            return *this = other;
+        }
+
+        template< typename T_Other >
+        HDINLINE ConstantReference & operator-=( T_Other const & other )
+        {
+            return *this = other;
+        }
+
+        template< typename T_Other >
+        HDINLINE ConstantReference & operator*=( T_Other const & other )
+        {
+            return *this = other;
+        }
+
+        template< typename T_Other >
+        HDINLINE ConstantReference & operator/=( T_Other const & other )
+        {
+            return *this = other;
+        }
+    };
+
+    //! true if T_Type is a reference to a constant attribute
+    template< typename T_Type >
+    struct IsConstantReference : std::false_type
+    {
+    };
+
+    template<
+        typename T_Value,
+        typename T_ValueFunctor
+    >
+    struct IsConstantReference< ConstantReference< T_Value, T_ValueFunctor > > : std::true_type
+    {
+    };
+
+    /** array of an attribute with the same value for all particles
+     *
+     * Drop-in replacement of StaticArray without memory per particle.
+     *
+     * @tparam T_Value value type of the attribute
+     * @tparam T_ValueFunctor functor returning the value of the attribute
+     * @tparam T_size number of elements (boost integral constant)
+     */
+    template<
+        typename T_Value,
+        typename T_ValueFunctor,
+        typename T_size
+    >
+    class ConstantStaticArray
+    {
+    public:
+        static constexpr uint32_t size = T_size::value;
+        typedef T_Value Type;
+        typedef ConstantReference< T_Value, T_ValueFunctor > Reference;
+
+        template<class> struct result;
+
+        template<class F, typename TKey>
+        struct result<F(TKey)>
+        {
+            typedef Reference type;
+        };
+
+        template<class F, typename TKey>
+        struct result<const F(TKey)>
+        {
+            typedef const Type type;
+        };
+
+        HDINLINE
+        Reference operator[](const int)
+        {
+            return Reference{};
+        }
+
+        HDINLINE
+        const Type operator[](const int) const
+        {
+            return T_ValueFunctor{}();
+        }
+    };
+
+} //namespace pmacc
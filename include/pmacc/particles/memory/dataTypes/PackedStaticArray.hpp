@@ -0,0 +1,166 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+#include "pmacc/particles/storage/Componentwise.hpp"
+
+
+namespace pmacc
+{
+
+    /** reference to an encoded attribute of a particle
+     *
+     * Reads decode the stored value to T_Value, writes encode it. Components
+     * of vector attributes are accessed with operator[], there is no C++
+     * reference to the decoded value (`auto & p = particle[ momentum_ ]`).
+     *
+     * @tparam T_Value value type of the attribute
+     * @tparam T_Codec scalar codec, @see particles::storage::Componentwise
+     */
+    template<
+        typename T_Value,
+        typename T_Codec
+    >
+    class PackedReference
+    {
+    public:
+        using Pack = particles::storage::Componentwise< T_Value, T_Codec >;
+        using Encoded = typename Pack::type;
+
+        HDINLINE PackedReference( Encoded & data ) : m_data( data )
+        {
+        }
+
+        HDINLINE operator T_Value() const
+        {
+            return Pack::load( m_data );
+        }
+
+        HDINLINE PackedReference & operator=( T_Value const & value )
+        {
+            Pack::store( m_data, value );
+            return *this;
+        }
+
+        HDINLINE PackedReference & operator=( PackedReference const & other )
+        {
+            return *this = static_cast< T_Value >( other );
+        }
+
+        template< typename T_Other >
+        HDINLINE PackedReference & operator+=( T_Other const & other )
+        {
+            return *this = T_Value( static_cast< T_Value >( *this ) + other );
+        }
+
+        template< typename T_Other >
+        HDINLINE PackedReference & operator-=( T_Other const & other )
+        {
+            return *this = T_Value( static_cast< T_Value >( *this ) - other );
+        }
+
+        template< typename T_Other >
+        HDINLINE PackedReference & operator*=( T_Other const & other )
+        {
+            return *this = T_Value( static_cast< T_Value >( *this ) * other );
+        }
+
+        template< typename T_Other >
+        HDINLINE PackedReference & operator/=( T_Other const & other )
+        {
+            return *this = T_Value( static_cast< T_Value >( *this ) / other );
+        }
+
+        /** reference to a component of a vector attribute
+         *
+         * e.g. `particle[ momentum_ ][ 0 ]`
+         */
+        template< typename T_Pack = Pack >
+        HDINLINE PackedReference<
+            typename T_Pack::ComponentValue,
+            T_Codec
+        >
+        operator[]( int const idx ) const
+        {
+            return PackedReference<
+                typename T_Pack::ComponentValue,
+                T_Codec
+            >( m_data[ idx ] );
+        }
+
+    private:
+        Encoded & m_data;
+    };
+
+    /** static array of encoded particle attributes
+     *
+     * Drop-in replacement of StaticArray, operator[] returns a PackedReference
+     * instead of a reference.
+     *
+     * @tparam T_Value value type of the attribute
+     * @tparam T_Codec scalar codec, e.g. particles::storage::BFloat16
+     * @tparam T_size number of elements (boost integral constant)
+     */
+    template<
+        typename T_Value,
+        typename T_Codec,
+        typename T_size
+    >
+    class PackedStaticArray
+    {
+    public:
+        static constexpr uint32_t size = T_size::value;
+        typedef T_Value Type;
+        typedef PackedReference< T_Value, T_Codec > Reference;
+    private:
+        typename Reference::Encoded data[size];
+    public:
+
+        template<class> struct result;
+
+        template<class F, typename TKey>
+        struct result<F(TKey)>
+        {
+            typedef Reference type;
+        };
+
+        template<class F, typename TKey>
+        struct result<const F(TKey)>
+        {
+            typedef const Type type;
+        };
+
+        HDINLINE
+        Reference operator[](const int idx)
+        {
+            return Reference(data[idx]);
+        }
+
+        HDINLINE
+        const Type operator[](const int idx) const
+        {
+            return Reference::Pack::load(data[idx]);
+        }
+    };
+
+} //namespace pmacc
@@ -29,6 +29,11 @@ namespace pmacc
 
 namespace pmath = pmacc::math;
 
+/** array of one attribute of all particles in a frame
+ *
+ * Arrays of more than one cache line are aligned to PMACC_SIMD_ALIGNMENT
+ * (@see pmacc/attribute/Simd.hpp).
+ */
 template<typename T_Type, typename T_size>
 class StaticArray
 {
@@ -36,7 +41,11 @@ public:
     static constexpr uint32_t size = T_size::value;
     typedef T_Type Type;
 private:
-    Type data[size];
+    static constexpr size_t alignment =
+        size * sizeof(Type) >= PMACC_SIMD_ALIGNMENT && PMACC_SIMD_ALIGNMENT > alignof(Type) ?
+        PMACC_SIMD_ALIGNMENT : alignof(Type);
+
+    alignas(alignment) Type data[size];
 public:
 
     template<class> struct result;
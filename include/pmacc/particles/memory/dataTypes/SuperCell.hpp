@@ -79,6 +79,14 @@ namespace pmacc
             return numParticles ? ( ( numParticles - 1u ) % frameSize + 1u ) : 0u;
         }
 
+        /** number of particles in the supercell
+         *
+         * The count is exact if the frames contain no gaps: it is updated by
+         * shifting (KernelShiftParticles), gap filling, sorting, deleting and
+         * by the creation and insertion of particles which fill the gaps
+         * afterwards. Between the push and the shift and in the GUARD after
+         * copyGuardToExchange the count is not valid.
+         */
         HDINLINE uint32_t getNumParticles() const
         {
             return numParticles;
@@ -24,6 +24,10 @@
 #include "pmacc/types.hpp"
 #include "pmacc/particles/Identifier.hpp"
 #include "pmacc/traits/HasIdentifier.hpp"
+#include "pmacc/particles/memory/dataTypes/ConstantStaticArray.hpp"
+
+#include <type_traits>
+#include <utility>
 
 namespace pmacc
 {
@@ -31,16 +35,45 @@ namespace pmacc
 namespace pmath = pmacc::math;
 
 
+/** copy an attribute
+ *
+ * Attributes with the same constant storage in both particles are skipped,
+ * they have the same value. Copying into another constant attribute fails
+ * to compile.
+ */
 template<typename T_Key>
 struct CopyIdentifier
 {
     template<typename T_T1,typename T_T2>
     HDINLINE
     void operator()(T_T1& dest, const T_T2& src)
+    {
+        typedef typename std::decay<decltype(dest[T_Key()])>::type DestReference;
+        typedef typename std::decay<decltype(std::declval<T_T2&>()[T_Key()])>::type SrcReference;
+        copy(
+            dest,
+            src,
+            std::integral_constant<
+                bool,
+                IsConstantReference<DestReference>::value &&
+                std::is_same<DestReference, SrcReference>::value
+            >()
+        );
+    }
+
+private:
+    template<typename T_T1,typename T_T2>
+    HDINLINE
+    void copy(T_T1& dest, const T_T2& src, std::false_type)
     {
         dest[T_Key()]=src[T_Key()];
     }
 
+    template<typename T_T1,typename T_T2>
+    HDINLINE
+    void copy(T_T1&, const T_T2&, std::true_type)
+    {
+    }
 
 };
 
@@ -33,6 +33,7 @@
 #include "pmacc/traits/GetNumWorkers.hpp"
 #include "pmacc/mappings/threads/ForEachIdx.hpp"
 #include "pmacc/mappings/threads/IdxConfig.hpp"
+#include "pmacc/type/AsyncResult.hpp"
 
 
 namespace pmacc
@@ -214,6 +215,74 @@ struct KernelCountParticles
     }
 };
 
+/** count the particles of all supercells
+ *
+ * Sums the particle count stored in each supercell instead of walking the
+ * frames. The count is only exact in supercells without gaps, see
+ * SuperCell::getNumParticles().
+ *
+ * @tparam T_numWorkers number of workers
+ */
+template< uint32_t T_numWorkers >
+struct KernelCountSuperCellParticles
+{
+    /** count particles
+     *
+     * @tparam T_PBox pmacc::ParticlesBox, particle box type
+     * @tparam T_Mapping supercell mapper functor type
+     * @tparam T_Acc type of the alpaka accelerator
+     *
+     * @param pb particle memory
+     * @param gCounter pointer for the result
+     * @param mapper functor to map a block to a supercell
+     */
+    template<
+        typename T_PBox,
+        typename T_Mapping,
+        typename T_Acc
+    >
+    DINLINE void operator( )(
+        T_Acc const & acc,
+        T_PBox pb,
+        uint64_cu* gCounter,
+        T_Mapping const mapper
+    ) const
+    {
+        using namespace mappings::threads;
+
+        constexpr uint32_t dim = T_Mapping::Dim;
+        constexpr uint32_t numWorkers = T_numWorkers;
+
+        uint32_t const workerIdx = cupla::threadIdx( acc ).x;
+
+        DataSpace< dim > const superCellIdx( mapper.getSuperCellIndex( DataSpace< dim >( cupla::blockIdx(acc) ) ) );
+
+        ForEachIdx<
+            IdxConfig<
+                1,
+                numWorkers
+            >
+        > onlyMaster{ workerIdx };
+
+        onlyMaster(
+            [&](
+                uint32_t const,
+                uint32_t const
+            )
+            {
+                uint32_t const numParticles = pb.getSuperCell( superCellIdx ).getNumParticles( );
+                if( numParticles != 0u )
+                    cupla::atomicAdd(
+                        acc,
+                        gCounter,
+                        static_cast< uint64_cu >( numParticles ),
+                        ::alpaka::hierarchy::Blocks{}
+                    );
+            }
+        );
+    }
+};
+
 struct CountParticles
 {
 
@@ -340,6 +409,91 @@ struct CountParticles
         return pmacc::CountParticles::countOnDevice < CORE + BORDER + GUARD > (buffer, cellDescription, origin, size, parFilter);
     }
 
+    /** Get the number of all particles without a filter
+     *
+     * Reduces the particle count of each supercell, no frame is read.
+     * The count of a supercell is kept exact by all operations which move,
+     * insert, delete or create particles (followed by the gap filling they
+     * require), therefore the result is valid for CORE and BORDER whenever
+     * no particle operation is in flight, e.g. in plugins.
+     * In the GUARD the count is reset by copyGuardToExchange.
+     *
+     * @tparam AREA area were particles are counted (CORE, BORDER, GUARD)
+     *
+     * @param buffer source particle buffer
+     * @param cellDescription instance of MappingDesction
+     * @return number of particles in defined area
+     */
+    template< uint32_t AREA, class PBuffer, class CellDesc >
+    static uint64_cu countSuperCells( PBuffer& buffer, CellDesc cellDescription )
+    {
+        return countSuperCellsAsync< AREA >( buffer, cellDescription ).get();
+    }
+
+    /** Get the number of all particles without a filter and without waiting for the result
+     *
+     * See countSuperCells(), the count is available as soon as the
+     * counting tasks are finished, e.g. for mpi::MPIReduce::async().
+     *
+     * @tparam AREA area were particles are counted (CORE, BORDER, GUARD)
+     *
+     * @param buffer source particle buffer
+     * @param cellDescription instance of MappingDesction
+     * @return AsyncResult with the number of particles in defined area
+     */
+    template< uint32_t AREA, class PBuffer, class CellDesc >
+    static AsyncResult< uint64_cu > countSuperCellsAsync( PBuffer& buffer, CellDesc cellDescription )
+    {
+        GridBuffer<
+            uint64_cu,
+            DIM1
+        > counter( DataSpace< DIM1 >( 1 ) );
+
+        Environment<>::task(
+            [ cellDescription ](
+                auto buffer,
+                auto counter
+            ){
+                AreaMapping<
+                    AREA,
+                    CellDesc
+                > mapper( cellDescription );
+
+                constexpr uint32_t numWorkers = 1u;
+
+                PMACC_KERNEL( KernelCountSuperCellParticles< numWorkers >{ } )(
+                    mapper.getGridDim( ),
+                    numWorkers
+                )(
+                    buffer.getParticlesBox( ),
+                    counter.getBasePointer( ),
+                    mapper
+                );
+            },
+
+            TaskProperties::Builder()
+                .label("KernelCountSuperCellParticles")
+                .scheduling_tags({ SCHED_CUPLA }),
+
+            buffer.getParticlesBuffer().device(),
+            counter.device().data().write()
+        );
+
+        counter.deviceToHost( );
+
+        AsyncResult< uint64_cu > count;
+        Environment<>::task(
+            []( auto counterData, auto count )
+            {
+                ( *count )[ 0 ] = counterData.getDataBox()[0];
+            },
+            TaskProperties::Builder().label("read particle count"),
+            counter.host().data().read(),
+            count.write()
+        );
+        return count;
+    }
+
 };
 
 } //namespace pmacc
@@ -23,6 +23,9 @@
 
 #include "pmacc/types.hpp"
 #include "pmacc/traits/Resolve.hpp"
+#include "pmacc/particles/memory/dataTypes/ConstantStaticArray.hpp"
+
+#include <type_traits>
 
 namespace pmacc
 {
@@ -43,11 +46,27 @@ struct SetAttributeToDefault
     template<typename T_Particle>
     HDINLINE
     void operator()(T_Particle& particle)
+    {
+        typedef typename std::decay<decltype(particle[Attribute()])>::type Reference;
+        set(particle, IsConstantReference<Reference>());
+    }
+
+private:
+    template<typename T_Particle>
+    HDINLINE
+    void set(T_Particle& particle, std::false_type)
     {
         typedef typename pmacc::traits::Resolve<Attribute>::type ResolvedAttr;
         /* set attribute to it's user defined default value */
         particle[Attribute()] = ResolvedAttr::getValue();
     }
+
+    /* the value of a constant attribute is defined by the species */
+    template<typename T_Particle>
+    HDINLINE
+    void set(T_Particle&, std::true_type)
+    {
+    }
 };
 
 
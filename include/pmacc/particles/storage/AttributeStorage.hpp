@@ -0,0 +1,179 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+#include "pmacc/identifier/alias.hpp"
+#include "pmacc/meta/GetKeyFromAlias.hpp"
+#include "pmacc/particles/memory/dataTypes/StaticArray.hpp"
+#include "pmacc/particles/memory/dataTypes/PackedStaticArray.hpp"
+#include "pmacc/particles/memory/dataTypes/ConstantStaticArray.hpp"
+#include "pmacc/particles/storage/Native.hpp"
+#include "pmacc/particles/storage/Constant.hpp"
+#include "pmacc/traits/Resolve.hpp"
+
+#include <boost/mpl/vector.hpp>
+#include <boost/mpl/find_if.hpp>
+#include <boost/mpl/end.hpp>
+#include <boost/mpl/deref.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+
+namespace pmacc
+{
+
+    /** species flag to select the storage of particle attributes
+     *
+     * The flag holds a sequence of `bmpl::pair< attribute, storage >`.
+     * Attributes without an entry are stored with their value type.
+     *
+     * @code{.cpp}
+     * attributeStorage<
+     *     MakeSeq_t<
+     *         bmpl::pair< position<>, particles::storage::FixedPoint< uint16_t > >,
+     *         bmpl::pair< momentum, particles::storage::BFloat16 >
+     *     >
+     * >
+     * @endcode
+     */
+    alias( attributeStorage );
+
+namespace particles
+{
+namespace storage
+{
+namespace detail
+{
+    //! true if the key of the pair @p T_Pair is @p T_Identifier or an alias of it
+    template<
+        typename T_Identifier,
+        typename T_Pair
+    >
+    struct IsStorageOf : boost::is_same<
+        typename GetKeyFromAlias<
+            bmpl::vector< T_Identifier >,
+            typename T_Pair::first
+        >::type,
+        T_Identifier
+    >
+    {
+    };
+
+    template< typename T_Iterator >
+    struct GetSecond
+    {
+        using type = typename bmpl::deref< T_Iterator >::type::second;
+    };
+} // namespace detail
+
+    /** storage of an attribute of a species
+     *
+     * @tparam T_FlagList flags of the species
+     * @tparam T_Identifier attribute
+     * @treturn ::type storage policy, Native if the species has no
+     *                 attributeStorage entry for the attribute
+     */
+    template<
+        typename T_FlagList,
+        typename T_Identifier
+    >
+    struct GetAttributeStorage
+    {
+    private:
+        using Flag = typename GetKeyFromAlias<
+            T_FlagList,
+            attributeStorage<>
+        >::type;
+
+        using StorageMap = typename bmpl::eval_if<
+            boost::is_same< Flag, bmpl::void_ >,
+            bmpl::identity< bmpl::vector< > >,
+            traits::Resolve< Flag >
+        >::type;
+
+        using Iterator = typename bmpl::find_if<
+            StorageMap,
+            detail::IsStorageOf<
+                T_Identifier,
+                bmpl::_1
+            >
+        >::type;
+
+    public:
+        using type = typename bmpl::eval_if<
+            boost::is_same<
+                Iterator,
+                typename bmpl::end< StorageMap >::type
+            >,
+            bmpl::identity< Native >,
+            detail::GetSecond< Iterator >
+        >::type;
+    };
+
+    /** array type to store an attribute in a frame
+     *
+     * @tparam T_Storage storage policy
+     * @tparam T_Value value type of the attribute
+     * @tparam T_size number of particles (boost integral constant)
+     */
+    template<
+        typename T_Storage,
+        typename T_Value,
+        typename T_size
+    >
+    struct MakeStorageArray
+    {
+        using type = PackedStaticArray< T_Value, T_Storage, T_size >;
+    };
+
+    template<
+        typename T_Value,
+        typename T_size
+    >
+    struct MakeStorageArray<
+        Native,
+        T_Value,
+        T_size
+    >
+    {
+        using type = StaticArray< T_Value, T_size >;
+    };
+
+    template<
+        typename T_ValueFunctor,
+        typename T_Value,
+        typename T_size
+    >
+    struct MakeStorageArray<
+        Constant< T_ValueFunctor >,
+        T_Value,
+        T_size
+    >
+    {
+        using type = ConstantStaticArray< T_Value, T_ValueFunctor, T_size >;
+    };
+
+} // namespace storage
+} // namespace particles
+} // namespace pmacc
@@ -0,0 +1,73 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace pmacc
+{
+namespace particles
+{
+namespace storage
+{
+
+    /** store floating point values as bfloat16
+     *
+     * bfloat16 has the exponent range of float with an 8 bit significand
+     * (relative rounding error 2^-8). The value is rounded to the nearest
+     * representable number, ties to even. Loads are promoted to the value
+     * type of the attribute, computations use the full precision.
+     */
+    struct BFloat16
+    {
+        using Bits = uint16_t;
+
+        template< typename T_Float >
+        static HDINLINE Bits encode( T_Float const value )
+        {
+            float const f = static_cast< float >( value );
+            uint32_t u;
+            memcpy( &u, &f, sizeof( u ) );
+            // keep NaN a (quiet) NaN instead of rounding it to infinity
+            if( ( u & 0x7fffffffu ) > 0x7f800000u )
+                return static_cast< Bits >( ( u >> 16 ) | 0x0040u );
+            u += 0x7fffu + ( ( u >> 16 ) & 1u );
+            return static_cast< Bits >( u >> 16 );
+        }
+
+        template< typename T_Float >
+        static HDINLINE T_Float decode( Bits const bits )
+        {
+            uint32_t const u = uint32_t( bits ) << 16;
+            float f;
+            memcpy( &f, &u, sizeof( f ) );
+            return static_cast< T_Float >( f );
+        }
+    };
+
+} // namespace storage
+} // namespace particles
+} // namespace pmacc
@@ -0,0 +1,97 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+#include "pmacc/math/Vector.hpp"
+
+
+namespace pmacc
+{
+namespace particles
+{
+namespace storage
+{
+
+    /** encode a scalar or each component of a vector with a scalar codec
+     *
+     * @tparam T_Value value type of the attribute (scalar or math::Vector)
+     * @tparam T_Codec codec with the encoded type `Bits` and the static
+     *                 methods `Bits encode(T)` and `T decode<T>(Bits)`
+     */
+    template<
+        typename T_Value,
+        typename T_Codec
+    >
+    struct Componentwise
+    {
+        //! encoded type
+        using type = typename T_Codec::Bits;
+
+        static HDINLINE T_Value load( type const & data )
+        {
+            return T_Codec::template decode< T_Value >( data );
+        }
+
+        static HDINLINE void store( type & data, T_Value const & value )
+        {
+            data = T_Codec::encode( value );
+        }
+    };
+
+    template<
+        typename T_Type,
+        int T_dim,
+        typename T_Accessor,
+        typename T_Navigator,
+        template< typename, int > class T_Storage,
+        typename T_Codec
+    >
+    struct Componentwise<
+        math::Vector< T_Type, T_dim, T_Accessor, T_Navigator, T_Storage >,
+        T_Codec
+    >
+    {
+        using Value = math::Vector< T_Type, T_dim, T_Accessor, T_Navigator, T_Storage >;
+        //! value type of a component
+        using ComponentValue = T_Type;
+        //! encoded type
+        using type = math::Vector< typename T_Codec::Bits, T_dim >;
+
+        static HDINLINE Value load( type const & data )
+        {
+            Value value;
+            for( int d = 0; d < T_dim; ++d )
+                value[ d ] = T_Codec::template decode< T_Type >( data[ d ] );
+            return value;
+        }
+
+        static HDINLINE void store( type & data, Value const & value )
+        {
+            for( int d = 0; d < T_dim; ++d )
+                data[ d ] = T_Codec::encode( value[ d ] );
+        }
+    };
+
+} // namespace storage
+} // namespace particles
+} // namespace pmacc
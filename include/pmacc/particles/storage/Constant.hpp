@@ -0,0 +1,48 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+
+namespace pmacc
+{
+namespace particles
+{
+namespace storage
+{
+
+    /** attribute with the same value for all particles of a species
+     *
+     * No memory is used per particle. Reads return the value of
+     * T_ValueFunctor, writes fail to compile. Setting the default value and
+     * copying from a species with the same constant storage are skipped.
+     *
+     * @tparam T_ValueFunctor type with `HDINLINE T_Value operator()() const`
+     *                        returning the value of the attribute
+     */
+    template< typename T_ValueFunctor >
+    struct Constant
+    {
+    };
+
+} // namespace storage
+} // namespace particles
+} // namespace pmacc
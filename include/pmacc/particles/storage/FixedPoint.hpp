@@ -0,0 +1,77 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+
+#include <type_traits>
+
+
+namespace pmacc
+{
+namespace particles
+{
+namespace storage
+{
+
+    /** store values of the range [0;1) as unsigned fixed-point numbers
+     *
+     * Suited for the in-cell position. The value is rounded to a multiple of
+     * 2^-bits of T_Int, values outside of [0;1) are clamped to the range.
+     *
+     * @tparam T_Int unsigned integral type of the encoded value
+     */
+    template< typename T_Int = uint16_t >
+    struct FixedPoint
+    {
+        PMACC_CASSERT_MSG(
+            FixedPoint_needs_an_unsigned_integral_type,
+            std::is_integral< T_Int >::value && std::is_unsigned< T_Int >::value
+        );
+
+        using Bits = T_Int;
+
+        template< typename T_Float >
+        static HDINLINE Bits encode( T_Float const value )
+        {
+            // 2^bits as floating point number
+            T_Float const scale = T_Float( Bits( ~Bits( 0u ) ) ) + T_Float( 1.0 );
+            T_Float const scaled = value * scale + T_Float( 0.5 );
+            // negated comparison maps NaN to zero
+            if( !( scaled >= T_Float( 0.0 ) ) )
+                return Bits( 0u );
+            if( scaled >= scale - T_Float( 1.0 ) )
+                return Bits( ~Bits( 0u ) );
+            return static_cast< Bits >( scaled );
+        }
+
+        template< typename T_Float >
+        static HDINLINE T_Float decode( Bits const bits )
+        {
+            T_Float const scale = T_Float( Bits( ~Bits( 0u ) ) ) + T_Float( 1.0 );
+            return T_Float( bits ) / scale;
+        }
+    };
+
+} // namespace storage
+} // namespace particles
+} // namespace pmacc
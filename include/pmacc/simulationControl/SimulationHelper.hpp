@@ -28,6 +28,7 @@
 #include "pmacc/mappings/simulation/GridController.hpp"
 #include "pmacc/dimensions/DataSpace.hpp"
 #include "TimeInterval.hpp"
+#include "StepCompletion.hpp"
 #include "pmacc/dataManagement/DataConnector.hpp"
 #include "pmacc/Environment.hpp"
 #include "pmacc/pluginSystem/IPlugin.hpp"
@@ -35,6 +36,7 @@
 #include "pmacc/pluginSystem/toTimeSlice.hpp"
 
 #include <boost/filesystem.hpp>
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <fstream>
@@ -198,8 +200,28 @@ public:
         return Environment<DIM>::get().GridController();
     }
 
+    /** print the progress of the simulation
+     *
+     * The average time per step is measured between the completion
+     * markers of the steps, i.e. it is the time the tasks of a step need to
+     * execute, not the time to submit them. The submission time and the
+     * number of steps in flight are reported in addition.
+     *
+     * @param tSimCalculation time since the begin of the calculation
+     * @param roundAvg accumulated submission time since the last output [msec]
+     * @param currentStep current simulation step
+     */
     void dumpTimes(TimeIntervall &tSimCalculation, TimeIntervall&, double& roundAvg, uint32_t currentStep)
     {
+        auto & stepCompletion = simulationControl::StepCompletion::getInstance();
+        for( auto const & epoch : stepCompletion.collectFinished() )
+        {
+            // overlapping steps of the pipeline are only counted once
+            roundExecAvg += epoch->finished - std::max( lastStepFinished, epoch->begin );
+            ++roundExecSteps;
+            lastStepFinished = epoch->finished;
+        }
+
         /*dump 100% after simulation*/
         if (output && progress && (currentStep % showProgressAnyStep) == 0)
         {
@@ -213,10 +235,17 @@ public:
                 " % = " << std::setw(8) << currentStep <<
                 " | time elapsed:" <<
                 std::setw(25) << tSimCalculation.printInterval() << " | avg time per step: " <<
-                TimeIntervall::printeTime(roundAvg / (double) showProgressAnyStep) << std::endl;
+                TimeIntervall::printeTime(
+                    roundExecSteps == 0u ? 0.0 : roundExecAvg / (double) roundExecSteps
+                ) <<
+                " | avg submission time per step: " <<
+                TimeIntervall::printeTime(roundAvg / (double) showProgressAnyStep) <<
+                " | steps in flight: " << stepCompletion.getPipelineDepth() << std::endl;
             std::cout.flush();
 
             roundAvg = 0.0; //clear round avg timer
+            roundExecAvg = 0.0;
+            roundExecSteps = 0u;
         }
 
     }
@@ -277,10 +306,9 @@ public:
             while (currentStep < Environment<>::get().SimulationDescription().getRunSteps())
             {
                 tRound.toggleStart();
+                simulationControl::StepCompletion::getInstance().beginStep(currentStep);
                 runOneStep(currentStep);
-
-                //Environment<>::get().waitForAllTasks();
-
+                simulationControl::StepCompletion::getInstance().endStep();
                 tRound.toggleEnd();
                 roundAvg += tRound.getInterval();
 
@@ -481,6 +509,13 @@ private:
     uint16_t progress;
     uint32_t showProgressAnyStep;
 
+    //! accumulated execution time of the finished steps since the last output [msec]
+    double roundExecAvg = 0.0;
+    //! number of steps finished since the last output
+    uint32_t roundExecSteps = 0u;
+    //! time when the last step finished [msec]
+    double lastStepFinished = 0.0;
+
     TimeIntervall tSimulation;
     TimeIntervall tInit;
 
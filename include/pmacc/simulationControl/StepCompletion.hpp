@@ -0,0 +1,211 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/simulationControl/TimeInterval.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace pmacc
+{
+namespace simulationControl
+{
+
+    /** completion marker for the tasks of one simulation step
+     *
+     * Every task emitted while a step is open (and every task emitted by
+     * such a task) holds a reference to the step. The step is finished when
+     * the last of these tasks is done, so the marker depends on all tasks of
+     * the step without emitting a barrier or an additional task.
+     */
+    struct StepEpoch
+    {
+        StepEpoch( uint32_t step ) :
+            step( step ),
+            begin( TimeIntervall::getTime() )
+        {
+        }
+
+        uint32_t step;
+
+        //! time when the first task of the step was submitted [msec]
+        double begin;
+        //! time when all tasks of the step were submitted [msec]
+        double submitted = 0.0;
+        //! time when the last task of the step finished [msec]
+        double finished = 0.0;
+
+        /** number of unfinished tasks
+         *
+         * Starts with one reference which is held by the submitting thread
+         * until StepCompletion::endStep() is called.
+         */
+        std::atomic< uint64_t > openTasks{ 1u };
+        std::atomic< bool > done{ false };
+    };
+
+    /** tracks the completion of simulation steps executed by the task runtime
+     *
+     * With asynchronous tasks, the time to call `runOneStep()` is only the
+     * submission time. The completion markers report when the step was
+     * actually executed and how many steps are in flight at the same time.
+     */
+    class StepCompletion
+    {
+    public:
+
+        using EpochPtr = std::shared_ptr< StepEpoch >;
+
+        /** keeps the thread local step of the running task up to date
+         * and releases the task reference when the task is finished
+         */
+        struct Scope
+        {
+            Scope( EpochPtr epoch ) :
+                epoch( std::move( epoch ) ),
+                outer( current() )
+            {
+                current() = this->epoch;
+            }
+
+            ~Scope()
+            {
+                current() = outer;
+                StepCompletion::release( epoch );
+            }
+
+            EpochPtr epoch;
+            EpochPtr outer;
+        };
+
+        static StepCompletion& getInstance()
+        {
+            static StepCompletion instance;
+            return instance;
+        }
+
+        /** open a new step, all tasks emitted from now on belong to it
+         *
+         * @param step index of the step
+         */
+        void beginStep( uint32_t step )
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            open = std::make_shared< StepEpoch >( step );
+            inFlight.push_back( open );
+        }
+
+        //! all tasks of the open step are submitted
+        void endStep()
+        {
+            EpochPtr epoch;
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                epoch = std::move( open );
+                open.reset();
+            }
+            if( epoch )
+            {
+                epoch->submitted = TimeIntervall::getTime();
+                release( epoch );
+            }
+        }
+
+        /** get the step a newly emitted task belongs to
+         *
+         * @return step of the calling task, else the open step,
+         *         nullptr if the task does not belong to a step
+         */
+        EpochPtr acquire()
+        {
+            EpochPtr epoch = current();
+            if( ! epoch )
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                epoch = open;
+            }
+            if( epoch )
+                ++epoch->openTasks;
+            return epoch;
+        }
+
+        /** remove all finished steps from the front of the queue
+         *
+         * Steps are returned in order, a finished step behind an
+         * unfinished one is returned with a later call.
+         */
+        std::vector< EpochPtr > collectFinished()
+        {
+            std::vector< EpochPtr > finished;
+            std::lock_guard< std::mutex > lock( mutex );
+            while( ! inFlight.empty() && inFlight.front()->done )
+            {
+                finished.push_back( inFlight.front() );
+                inFlight.pop_front();
+            }
+            return finished;
+        }
+
+        //! number of submitted steps which are not finished yet
+        std::size_t getPipelineDepth()
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            std::size_t depth = 0u;
+            for( auto const & epoch : inFlight )
+                if( ! epoch->done && epoch != open )
+                    ++depth;
+            return depth;
+        }
+
+        static void release( EpochPtr const & epoch )
+        {
+            if( epoch && --epoch->openTasks == 0u )
+            {
+                epoch->finished = TimeIntervall::getTime();
+                epoch->done = true;
+            }
+        }
+
+    private:
+
+        StepCompletion() = default;
+
+        //! step of the task which is executed by the calling thread
+        static EpochPtr & current()
+        {
+            thread_local EpochPtr epoch;
+            return epoch;
+        }
+
+        std::mutex mutex;
+        EpochPtr open;
+        std::deque< EpochPtr > inFlight;
+    };
+
+} // namespace simulationControl
+} // namespace pmacc
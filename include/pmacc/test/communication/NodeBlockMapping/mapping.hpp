@@ -0,0 +1,146 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/* #includes in "test/communicationUT.cpp" */
+
+
+namespace pmacc
+{
+namespace test
+{
+namespace communication
+{
+namespace NodeBlockMapping
+{
+
+/**
+ * Checks the assignment of the ranks of each node to a brick of the
+ * process grid and the rank <-> coordinate mapping of the bricks.
+ */
+struct MappingTest
+{
+    //! node index of each rank in the process grid
+    static std::vector< int > getNodeOfCartRank(
+        ::pmacc::NodeBlockMapping const & mapping,
+        std::vector< int > const & nodeOfRank
+    )
+    {
+        std::vector< int > nodeOfCartRank( nodeOfRank.size(), -1 );
+        for( std::size_t rank = 0u; rank < nodeOfRank.size(); ++rank )
+        {
+            int const cartRank = mapping.getCartRank( rank );
+            BOOST_REQUIRE( cartRank >= 0 && cartRank < int( nodeOfRank.size() ) );
+            // each position of the process grid is assigned once
+            BOOST_REQUIRE_EQUAL( nodeOfCartRank[ cartRank ], -1 );
+            nodeOfCartRank[ cartRank ] = nodeOfRank[ rank ];
+        }
+        return nodeOfCartRank;
+    }
+
+    void exec()
+    {
+        // 2x2 grid, two nodes with interleaved ranks
+        {
+            std::vector< int > const nodeOfRank{ 0, 1, 0, 1 };
+            std::vector< int > const localIndexOfRank{ 0, 0, 1, 1 };
+            ::pmacc::NodeBlockMapping const mapping(
+                ::pmacc::DataSpace< DIM3 >( 2, 2, 1 ),
+                ::pmacc::DataSpace< DIM3 >( 0, 0, 0 ),
+                nodeOfRank,
+                localIndexOfRank
+            );
+            BOOST_REQUIRE( mapping.isValid() );
+            BOOST_CHECK( mapping.getBrick() == ::pmacc::DataSpace< DIM3 >( 1, 2, 1 ) );
+
+            // cart rank = ( x * 2 + y ), node n owns the row x = n
+            BOOST_CHECK_EQUAL( mapping.getCartRank( 0 ), 0 );
+            BOOST_CHECK_EQUAL( mapping.getCartRank( 1 ), 2 );
+            BOOST_CHECK_EQUAL( mapping.getCartRank( 2 ), 1 );
+            BOOST_CHECK_EQUAL( mapping.getCartRank( 3 ), 3 );
+
+            auto const nodeOfCartRank = getNodeOfCartRank( mapping, nodeOfRank );
+            BOOST_CHECK_EQUAL( mapping.countInterNodeFaces( nodeOfCartRank ), 2u );
+            BOOST_CHECK_EQUAL( mapping.getInterNodeFaces(), 2u );
+        }
+
+        // 4x4 grid periodic in x, four nodes with consecutive ranks
+        {
+            ::pmacc::DataSpace< DIM3 > const dims( 4, 4, 1 );
+            std::vector< int > nodeOfRank( 16 );
+            std::vector< int > localIndexOfRank( 16 );
+            for( int rank = 0; rank < 16; ++rank )
+            {
+                nodeOfRank[ rank ] = rank / 4;
+                localIndexOfRank[ rank ] = rank % 4;
+            }
+            ::pmacc::NodeBlockMapping const mapping(
+                dims,
+                ::pmacc::DataSpace< DIM3 >( 1, 0, 0 ),
+                nodeOfRank,
+                localIndexOfRank
+            );
+            BOOST_REQUIRE( mapping.isValid() );
+            BOOST_CHECK( mapping.getBrick() == ::pmacc::DataSpace< DIM3 >( 2, 2, 1 ) );
+
+            // the ranks of a node form a 2x2 brick at an even coordinate
+            for( int rank = 0; rank < 16; ++rank )
+            {
+                int const cartRank = mapping.getCartRank( rank );
+                int const x = cartRank / 4;
+                int const y = cartRank % 4;
+                int const node = nodeOfRank[ rank ];
+                BOOST_CHECK_EQUAL( x / 2, node / 2 );
+                BOOST_CHECK_EQUAL( y / 2, node % 2 );
+                BOOST_CHECK_EQUAL( x % 2, localIndexOfRank[ rank ] / 2 );
+                BOOST_CHECK_EQUAL( y % 2, localIndexOfRank[ rank ] % 2 );
+            }
+
+            auto const nodeOfCartRank = getNodeOfCartRank( mapping, nodeOfRank );
+            BOOST_CHECK_EQUAL( mapping.countInterNodeFaces( nodeOfCartRank ), 12u );
+            BOOST_CHECK_EQUAL( mapping.getInterNodeFaces(), 12u );
+            // the identity mapping places each node in a periodic x slab
+            BOOST_CHECK_EQUAL( mapping.countInterNodeFaces( nodeOfRank ), 16u );
+        }
+
+        // nodes with a different number of ranks
+        {
+            ::pmacc::NodeBlockMapping const mapping(
+                ::pmacc::DataSpace< DIM3 >( 3, 1, 1 ),
+                ::pmacc::DataSpace< DIM3 >( 0, 0, 0 ),
+                std::vector< int >{ 0, 0, 1 },
+                std::vector< int >{ 0, 1, 0 }
+            );
+            BOOST_CHECK( !mapping.isValid() );
+        }
+    }
+};
+
+} // namespace NodeBlockMapping
+} // namespace communication
+} // namespace test
+} // namespace pmacc
+
+BOOST_AUTO_TEST_CASE( mapping )
+{
+    pmacc::test::communication::NodeBlockMapping::MappingTest().exec();
+}
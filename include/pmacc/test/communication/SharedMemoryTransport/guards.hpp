@@ -0,0 +1,158 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/* #includes in "test/communicationUT.cpp" */
+
+
+namespace pmacc
+{
+namespace test
+{
+namespace communication
+{
+namespace SharedMemoryTransport
+{
+
+/**
+ * Checks that the guards received through the shared memory transport
+ * are equal to the guards received over MPI.
+ *
+ * The single rank of the test is its own neighbor in all directions
+ * (periodic), so all exchanges are node local.
+ */
+template< uint32_t T_dim >
+struct GuardsTest
+{
+    using Buffer = ::pmacc::mem::GridBuffer< int, T_dim >;
+
+    //! linear cell index in the CORE and BORDER, -1 in the GUARD
+    static void fill( Buffer & buffer, ::pmacc::GridLayout< T_dim > const & layout )
+    {
+        using namespace ::pmacc;
+
+        DataSpace< T_dim > const size = layout.getDataSpace();
+        DataSpace< T_dim > const guard = layout.getGuard();
+
+        Environment<>::task(
+            [size, guard]( auto host_buffer )
+            {
+                DataBoxDim1Access< DataBox< PitchedBox< int, T_dim > > > d1Box(
+                    host_buffer.data().getDataBox(),
+                    size
+                );
+                for( int i = 0; i < size.productOfComponents(); ++i )
+                {
+                    DataSpace< T_dim > const cell = DataSpaceOperations< T_dim >::map( size, i );
+                    bool isGuard = false;
+                    for( uint32_t d = 0u; d < T_dim; ++d )
+                        if( cell[ d ] < guard[ d ] || cell[ d ] >= size[ d ] - guard[ d ] )
+                            isGuard = true;
+                    d1Box[ i ] = isGuard ? -1 : i;
+                }
+            },
+            TaskProperties::Builder().label( "GuardsTest::fill" ),
+            buffer.host().write()
+        );
+        ::pmacc::mem::buffer::copy( buffer.device().write(), buffer.host().read() );
+    }
+
+    //! all cells of the buffer after the submitted exchanges
+    static std::vector< int > read( Buffer & buffer, ::pmacc::GridLayout< T_dim > const & layout )
+    {
+        using namespace ::pmacc;
+
+        DataSpace< T_dim > const size = layout.getDataSpace();
+
+        ::pmacc::mem::buffer::copy( buffer.host().write(), buffer.device().read() );
+        return Environment<>::task(
+            [size]( auto host_buffer )
+            {
+                DataBoxDim1Access< DataBox< PitchedBox< int, T_dim > > > d1Box(
+                    host_buffer.data().getDataBox(),
+                    size
+                );
+                std::vector< int > cells( size.productOfComponents() );
+                for( std::size_t i = 0u; i < cells.size(); ++i )
+                    cells[ i ] = d1Box[ i ];
+                return cells;
+            },
+            TaskProperties::Builder().label( "GuardsTest::read" ),
+            buffer.host().read()
+        ).get();
+    }
+
+    void exec()
+    {
+        using namespace ::pmacc;
+
+        GridLayout< T_dim > const layout(
+            DataSpace< T_dim >::create( 8 ),
+            DataSpace< T_dim >::create( 2 )
+        );
+        Buffer buffer( layout );
+        for( uint32_t ex = 1u; ex < ::pmacc::traits::NumberOfExchanges< T_dim >::value; ++ex )
+            buffer.addExchange( GUARD, Mask( ex ), layout.getGuard(), 1u );
+
+        ::pmacc::mem::ExchangeAggregator< T_dim > aggregator( 2u );
+        aggregator.add( buffer );
+
+        auto & transport = ::pmacc::SharedMemoryTransport::getInstance();
+        BOOST_REQUIRE( !transport.isLocal( RIGHT ) );
+
+        // reference: all messages over MPI
+        fill( buffer, layout );
+        buffer.communication();
+        std::vector< int > const mpiCells = read( buffer, layout );
+
+        for( int const cell : mpiCells )
+            BOOST_REQUIRE_NE( cell, -1 );
+
+        transport.init( Environment< T_dim >::get().GridController().getCommunicator().getMPIComm() );
+        BOOST_REQUIRE( transport.isLocal( RIGHT ) );
+
+        // byte messages of the aggregator through the transport
+        fill( buffer, layout );
+        aggregator.communication();
+        std::vector< int > const aggregatedCells = read( buffer, layout );
+        BOOST_CHECK( aggregatedCells == mpiCells );
+
+        // messages of the buffer, staged on the host for accelerator backends
+        fill( buffer, layout );
+        buffer.communication();
+        std::vector< int > const bufferCells = read( buffer, layout );
+        BOOST_CHECK( bufferCells == mpiCells );
+
+        transport.finalize();
+        BOOST_CHECK( !transport.isLocal( RIGHT ) );
+    }
+};
+
+} // namespace SharedMemoryTransport
+} // namespace communication
+} // namespace test
+} // namespace pmacc
+
+BOOST_AUTO_TEST_CASE( guards )
+{
+    pmacc::test::communication::SharedMemoryTransport::GuardsTest< TEST_DIM >().exec();
+}
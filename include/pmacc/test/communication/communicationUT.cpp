@@ -0,0 +1,62 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pmacc/test/PMaccFixture.hpp"
+
+// STL
+#include <cstddef>
+#include <vector>
+
+// BOOST
+#include <boost/test/unit_test.hpp>
+
+// PMacc
+#include <pmacc/communication/NodeBlockMapping.hpp>
+#include <pmacc/communication/SharedMemoryTransport.hpp>
+#include <pmacc/dimensions/DataSpace.hpp>
+#include <pmacc/dimensions/DataSpaceOperations.hpp>
+#include <pmacc/dimensions/GridLayout.hpp>
+#include <pmacc/Environment.hpp>
+#include <pmacc/memory/boxes/DataBoxDim1Access.hpp>
+#include <pmacc/memory/buffers/GridBuffer.hpp>
+#include <pmacc/memory/buffers/gridBuffer/ExchangeAggregator.hpp>
+#include <pmacc/traits/NumberOfExchanges.hpp>
+#include "pmacc/types.hpp" /* DIM3 */
+
+
+/*******************************************************************************
+ * Test Suites
+ ******************************************************************************/
+using MyPMaccFixture = pmacc::test::PMaccFixture< TEST_DIM >;
+
+BOOST_GLOBAL_FIXTURE( MyPMaccFixture );
+
+BOOST_AUTO_TEST_SUITE( communication )
+
+  BOOST_AUTO_TEST_SUITE( NodeBlockMapping )
+#   include "NodeBlockMapping/mapping.hpp"
+  BOOST_AUTO_TEST_SUITE_END()
+
+  BOOST_AUTO_TEST_SUITE( SharedMemoryTransport )
+#   include "SharedMemoryTransport/guards.hpp"
+  BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
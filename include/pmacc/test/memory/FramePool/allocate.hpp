@@ -0,0 +1,100 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/* #includes in "test/memoryUT.cpp" */
+
+
+namespace pmacc
+{
+namespace test
+{
+namespace memory
+{
+namespace FramePool
+{
+
+/**
+ * Checks that the blocks of a FramePool are distinct, aligned and reused
+ * and that the memory limit is respected.
+ */
+struct AllocateTest
+{
+    void exec()
+    {
+        using Pool = ::pmacc::memory::FramePool;
+        // the handle ignores the accelerator on the host
+        int const acc = 0;
+
+        Pool pool;
+        auto handle = pool.getAllocatorHandle();
+
+        constexpr size_t frameSize = 12345u;
+        constexpr uint32_t numFrames = 1000u;
+        std::set< void* > frames;
+        for( uint32_t i = 0u; i < numFrames; ++i )
+        {
+            void* const frame = handle.malloc( acc, frameSize );
+            BOOST_REQUIRE( frame != nullptr );
+            BOOST_CHECK_EQUAL( reinterpret_cast< uintptr_t >( frame ) % Pool::alignment, 0u );
+            BOOST_CHECK( frames.insert( frame ).second );
+            std::memset( frame, 0xff, frameSize );
+        }
+
+        // a second size class must not overlap with the first one
+        void* const other = handle.malloc( acc, 2u * frameSize );
+        BOOST_REQUIRE( other != nullptr );
+        for( void* frame : frames )
+            BOOST_CHECK(
+                static_cast< char* >( other ) + 2u * frameSize <= frame ||
+                static_cast< char* >( frame ) + frameSize <= other
+            );
+        handle.free( acc, other );
+
+        size_t const allocatedBytes = pool.getAllocatedBytes();
+        for( void* frame : frames )
+            handle.free( acc, frame );
+        // freed frames are reused without new slabs
+        for( uint32_t i = 0u; i < numFrames; ++i )
+            BOOST_REQUIRE( handle.malloc( acc, frameSize ) != nullptr );
+        BOOST_CHECK_EQUAL( pool.getAllocatedBytes(), allocatedBytes );
+
+        // a limited pool runs out of memory
+        Pool smallPool( 2u * Pool::slabSize );
+        auto smallHandle = smallPool.getAllocatorHandle();
+        uint32_t numAllocated = 0u;
+        while( smallHandle.malloc( acc, frameSize ) != nullptr )
+            ++numAllocated;
+        size_t const stride = Pool::alignment + ( frameSize + Pool::alignment - 1u ) / Pool::alignment * Pool::alignment;
+        BOOST_CHECK_EQUAL( numAllocated, 2u * ( Pool::slabSize / stride ) );
+    }
+};
+
+} // namespace FramePool
+} // namespace memory
+} // namespace test
+} // namespace pmacc
+
+BOOST_AUTO_TEST_CASE( allocate )
+{
+    pmacc::test::memory::FramePool::AllocateTest().exec();
+}
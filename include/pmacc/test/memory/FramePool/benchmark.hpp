@@ -0,0 +1,191 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/* #includes in "test/memoryBenchmark.cpp" */
+
+
+namespace pmacc
+{
+namespace test
+{
+namespace memory
+{
+namespace FramePool
+{
+
+/** heap handle which creates each frame with `new`
+ *
+ * This is the frame allocation of CPU accelerators without FramePool.
+ */
+struct NewDeleteHandle
+{
+    template< typename T_Acc >
+    HINLINE void* malloc( T_Acc const &, size_t const bytes ) const
+    {
+        return ::operator new( bytes, std::nothrow );
+    }
+
+    template< typename T_Acc >
+    HINLINE void free( T_Acc const &, void* const ptr ) const
+    {
+        ::operator delete( ptr );
+    }
+};
+
+/** allocate and free frames in each worker
+ *
+ * Frames are freed in a different order than allocated, as the frames
+ * of a supercell in KernelFillGaps or KernelDeleteParticles.
+ */
+template<
+    uint32_t T_numWorkers,
+    uint32_t T_framesPerWorker
+>
+struct KernelAllocFrames
+{
+    template<
+        typename T_Acc,
+        typename T_DeviceHeapHandle
+    >
+    DINLINE void operator()(
+        T_Acc const & acc,
+        T_DeviceHeapHandle const deviceHeapHandle,
+        uint32_t const numRounds,
+        uint32_t const frameSize,
+        uint32_t * const numFailed
+    ) const
+    {
+        using namespace ::pmacc::mappings::threads;
+
+        uint32_t const workerIdx = cupla::threadIdx( acc ).x;
+
+        ForEachIdx<
+            IdxConfig<
+                T_numWorkers,
+                T_numWorkers
+            >
+        >{ workerIdx }(
+            [&](
+                uint32_t const,
+                uint32_t const
+            )
+            {
+                void* frames[ T_framesPerWorker ];
+                for( uint32_t r = 0u; r < numRounds; ++r )
+                {
+                    for( uint32_t i = 0u; i < T_framesPerWorker; ++i )
+                    {
+                        frames[ i ] = deviceHeapHandle.malloc( acc, frameSize );
+                        if( frames[ i ] == nullptr )
+                            cupla::atomicAdd( acc, numFailed, 1u, ::alpaka::hierarchy::Blocks{ } );
+                        else
+                            *static_cast< uint32_t* >( frames[ i ] ) = i;
+                    }
+                    for( uint32_t i = 0u; i < T_framesPerWorker; ++i )
+                    {
+                        void* const frame = frames[ ( i * 3u + r ) % T_framesPerWorker ];
+                        if( frame != nullptr )
+                            deviceHeapHandle.free( acc, frame );
+                    }
+                }
+            }
+        );
+    }
+};
+
+/**
+ * Measures the frame allocations per second of FramePool and of `new`
+ * with the cupla accelerator of the test (e.g. threads or OpenMP backend).
+ */
+struct BenchmarkTest
+{
+    static constexpr uint32_t framesPerWorker = 8u;
+
+    //! @return allocations per second
+    template< typename T_DeviceHeapHandle >
+    double run(
+        T_DeviceHeapHandle const deviceHeapHandle,
+        uint32_t const numBlocks,
+        uint32_t const numRounds,
+        uint32_t const frameSize
+    )
+    {
+        constexpr uint32_t numWorkers = ::pmacc::traits::GetNumWorkers< 64u >::value;
+
+        // the kernel runs on the host, it can count in host memory
+        uint32_t numFailed = 0u;
+        double const seconds = ::pmacc::Environment<>::task(
+            [ & ]
+            {
+                auto const start = std::chrono::steady_clock::now( );
+                PMACC_KERNEL( KernelAllocFrames< numWorkers, framesPerWorker >{ } )(
+                    numBlocks,
+                    numWorkers
+                )(
+                    deviceHeapHandle,
+                    numRounds,
+                    frameSize,
+                    &numFailed
+                );
+                return std::chrono::duration< double >( std::chrono::steady_clock::now( ) - start ).count( );
+            },
+            ::pmacc::TaskProperties::Builder( )
+                .label( "FramePool benchmark" )
+                .scheduling_tags( { ::pmacc::SCHED_CUPLA } )
+        ).get( );
+
+        BOOST_CHECK_EQUAL( numFailed, 0u );
+        return double( numBlocks ) * numWorkers * numRounds * framesPerWorker / seconds;
+    }
+
+    void exec()
+    {
+        uint32_t const numBlocks = 4u * std::max( std::thread::hardware_concurrency( ), 1u );
+        constexpr uint32_t numRounds = 2000u;
+        // a frame of 256 particles with 48 byte each
+        constexpr uint32_t frameSize = 256u * 48u;
+
+        ::pmacc::memory::FramePool pool;
+        // first run allocates the slabs
+        run( pool.getAllocatorHandle( ), numBlocks, 1u, frameSize );
+
+        double const poolRate = run( pool.getAllocatorHandle( ), numBlocks, numRounds, frameSize );
+        double const newRate = run( NewDeleteHandle{ }, numBlocks, numRounds, frameSize );
+
+        std::cout << "FramePool: " << poolRate << " allocations/s, "
+                  << "new/delete: " << newRate << " allocations/s, "
+                  << "speedup " << poolRate / newRate
+                  << " (" << numBlocks << " blocks, frame size " << frameSize << " byte)"
+                  << std::endl;
+    }
+};
+
+} // namespace FramePool
+} // namespace memory
+} // namespace test
+} // namespace pmacc
+
+BOOST_AUTO_TEST_CASE( benchmark )
+{
+    pmacc::test::memory::FramePool::BenchmarkTest().exec();
+}
@@ -0,0 +1,102 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/* #includes in "test/memoryUT.cpp" */
+
+
+namespace pmacc
+{
+namespace test
+{
+namespace memory
+{
+namespace FramePool
+{
+
+/**
+ * Checks the occupancy statistics of a FramePool and that grow() adds slabs
+ * until the occupancy is below the threshold.
+ */
+struct GrowTest
+{
+    void exec()
+    {
+        using Pool = ::pmacc::memory::FramePool;
+        // the handle ignores the accelerator on the host
+        int const acc = 0;
+
+        // local copies, the checks bind their arguments to references
+        size_t const slabSize = Pool::slabSize;
+        size_t const frameSize = 4096u;
+        size_t const stride = Pool::alignment + frameSize;
+        size_t const blocksPerSlab = slabSize / stride;
+
+        Pool pool( 4u * slabSize );
+        auto handle = pool.getAllocatorHandle();
+        BOOST_CHECK_EQUAL( pool.getUsedBytes(), 0u );
+        BOOST_CHECK_EQUAL( pool.getMaxBytes(), 4u * slabSize );
+
+        // fill the first slab up to the last block
+        std::vector< void* > frames;
+        for( size_t i = 0u; i + 1u < blocksPerSlab; ++i )
+        {
+            void* const frame = handle.malloc( acc, frameSize );
+            BOOST_REQUIRE( frame != nullptr );
+            frames.push_back( frame );
+        }
+        BOOST_CHECK_EQUAL( pool.getAllocatedBytes(), slabSize );
+        // the blocks cached by this thread count as used
+        BOOST_CHECK( pool.getUsedBytes() >= frames.size() * stride );
+        BOOST_CHECK( pool.getUsedBytes() <= slabSize );
+
+        // one slab is enough to get below the threshold
+        BOOST_CHECK_EQUAL( pool.grow( 0.9 ), slabSize );
+        BOOST_CHECK_EQUAL( pool.grow( 0.9 ), 0u );
+
+        // the limit is respected
+        BOOST_CHECK_EQUAL( pool.grow( 0.1 ), 2u * slabSize );
+        BOOST_CHECK_EQUAL( pool.getAllocatedBytes(), 4u * slabSize );
+
+        // no limit by default, a limit of zero bytes allows no slab
+        size_t const unlimited = Pool::unlimited;
+        Pool unlimitedPool;
+        BOOST_CHECK_EQUAL( unlimitedPool.getMaxBytes(), unlimited );
+        Pool emptyPool( 0u );
+        BOOST_CHECK( emptyPool.getAllocatorHandle().malloc( acc, frameSize ) == nullptr );
+
+        // freed blocks are counted as free after leaving the thread cache
+        for( void* frame : frames )
+            handle.free( acc, frame );
+        BOOST_CHECK( pool.getUsedBytes() <= Pool::cacheSize * stride );
+    }
+};
+
+} // namespace FramePool
+} // namespace memory
+} // namespace test
+} // namespace pmacc
+
+BOOST_AUTO_TEST_CASE( grow )
+{
+    pmacc::test::memory::FramePool::GrowTest().exec();
+}
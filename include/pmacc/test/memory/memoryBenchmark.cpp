@@ -0,0 +1,60 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pmacc/test/PMaccFixture.hpp"
+
+// STL
+#include <stdint.h>
+#include <iostream> /* cout, endl */
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <new>
+
+// BOOST
+#include <boost/test/unit_test.hpp>
+
+// PMacc
+#include <pmacc/Environment.hpp>
+#include <pmacc/memory/FramePool.hpp>
+#include <pmacc/mappings/threads/ForEachIdx.hpp>
+#include <pmacc/mappings/threads/IdxConfig.hpp>
+#include <pmacc/traits/GetNumWorkers.hpp>
+#include "pmacc/types.hpp"
+
+
+/*******************************************************************************
+ * Benchmarks, the executable is not run by CTest
+ ******************************************************************************/
+using MyPMaccFixture = pmacc::test::PMaccFixture< TEST_DIM >;
+
+BOOST_GLOBAL_FIXTURE( MyPMaccFixture );
+
+BOOST_AUTO_TEST_SUITE( memory )
+
+/* the frame pool is only used by accelerators sharing the host memory */
+#if( !BOOST_LANG_CUDA && !BOOST_COMP_HIP )
+  BOOST_AUTO_TEST_SUITE( FramePool )
+#   include "FramePool/benchmark.hpp"
+  BOOST_AUTO_TEST_SUITE_END()
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -25,6 +25,9 @@
 #include <stdint.h> /* uint8_t */
 #include <iostream> /* cout, endl */
 #include <string>
+#include <set>
+#include <cstring>
+#include <vector>
 
 // BOOST
 #include <boost/test/unit_test.hpp>
@@ -43,6 +46,7 @@
 #include <pmacc/memory/buffers/DeviceBufferIntern.hpp>
 #include <pmacc/memory/buffers/DeviceBuffer.hpp>
 #include <pmacc/dimensions/DataSpace.hpp>
+#include <pmacc/memory/FramePool.hpp>
 #include "pmacc/types.hpp" /* DIM1,DIM2,DIM3 */
 
 
@@ -110,4 +114,12 @@ BOOST_AUTO_TEST_SUITE( memory )
 #   include "HostBufferIntern/setValue.hpp"
   BOOST_AUTO_TEST_SUITE_END()
 
+/* the frame pool is only used by accelerators sharing the host memory */
+#if( !BOOST_LANG_CUDA && !BOOST_COMP_HIP )
+  BOOST_AUTO_TEST_SUITE( FramePool )
+#   include "FramePool/allocate.hpp"
+#   include "FramePool/grow.hpp"
+  BOOST_AUTO_TEST_SUITE_END()
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -173,11 +173,30 @@ struct IdProviderTest
         idBuf.deviceToHost();
         BOOST_REQUIRE_EQUAL(numIds, ids.size());
         auto hostBox = idBuf.getHostBuffer().getDataBox();
+#if( BOOST_LANG_CUDA || BOOST_COMP_HIP )
         // Make sure they are the same
         for(uint32_t i=0; i<numIds; i++)
         {
             BOOST_REQUIRE(checkDuplicate(ids, hostBox(i), true));
         }
+#else
+        /* Workers of CPU accelerators hand out ids of reserved ranges,
+         * make sure the ids are unique and below the state
+         */
+        std::set<uint64_t> deviceIds;
+        uint64_t const endId = IdProvider::getState().nextId;
+        for(uint32_t i=0; i<numIds; i++)
+        {
+            BOOST_REQUIRE(checkDuplicate(deviceIds, hostBox(i), false));
+            deviceIds.insert(hostBox(i));
+            BOOST_REQUIRE_GE(hostBox(i), state.nextId);
+            BOOST_REQUIRE_LT(hostBox(i), endId);
+        }
+#endif
+        // Ids are exact again after a reset
+        IdProvider::setState(state);
+        BOOST_REQUIRE_EQUAL(IdProvider::getState().nextId, state.nextId);
+        BOOST_REQUIRE_EQUAL(IdProvider::getNewIdHost(), state.nextId);
     }
 };
 
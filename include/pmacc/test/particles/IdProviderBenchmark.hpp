@@ -0,0 +1,186 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <pmacc/types.hpp>
+#include <pmacc/particles/IdProvider.hpp>
+#include <pmacc/memory/buffers/HostDeviceBuffer.hpp>
+#include <pmacc/eventSystem/EventSystem.hpp>
+#include <pmacc/mappings/threads/ForEachIdx.hpp>
+#include <pmacc/mappings/threads/IdxConfig.hpp>
+#include <pmacc/nvidia/atomic.hpp>
+#include <pmacc/traits/GetNumWorkers.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <stdint.h>
+#if defined( _OPENMP )
+#   include <omp.h>
+#endif
+
+BOOST_AUTO_TEST_SUITE( particles )
+
+
+namespace pmacc
+{
+namespace test
+{
+namespace particles
+{
+    //! counter of SharedCounterId
+    DEVICEONLY uint64_cu sharedCounter;
+
+    //! ids from one global counter, the IdProvider without reserved ranges
+    struct SharedCounterId
+    {
+        HDINLINE uint64_t operator()() const
+        {
+            return static_cast< uint64_t >( ::pmacc::nvidia::atomicAllInc( &sharedCounter ) );
+        }
+    };
+
+    /** create ids in all workers
+     *
+     * The xor of the ids of each worker is stored to keep the calls.
+     */
+    template<
+        uint32_t T_numWorkers,
+        typename T_IdFactory
+    >
+    struct KernelCreateIds
+    {
+        template< class T_Box, typename T_Acc >
+        DINLINE void operator()( const T_Acc & acc, T_Box outputbox, uint32_t numIdsPerWorker ) const
+        {
+            using namespace ::pmacc::mappings::threads;
+
+            uint32_t const workerIdx = cupla::threadIdx( acc ).x;
+            uint32_t const blockId = cupla::blockIdx( acc ).x;
+
+            ForEachIdx<
+                IdxConfig<
+                    T_numWorkers,
+                    T_numWorkers
+                >
+            >{ workerIdx }(
+                [&](
+                    uint32_t const linearIdx,
+                    uint32_t const
+                )
+                {
+                    T_IdFactory idFactory;
+                    uint64_t hash = 0u;
+                    for( uint32_t i = 0u; i < numIdsPerWorker; ++i )
+                        hash ^= idFactory( );
+                    outputbox( blockId * T_numWorkers + linearIdx ) = hash;
+                }
+            );
+        }
+    };
+
+    /**
+     * Measures the created ids per second of the IdProvider and of one
+     * global counter for an increasing number of OpenMP threads (CPU
+     * accelerators) or once with the default configuration.
+     */
+    template< unsigned T_dim >
+    struct IdProviderBenchmark
+    {
+        static constexpr uint32_t numWorkers = ::pmacc::traits::GetNumWorkers< 64u >::value;
+        static constexpr uint32_t numBlocks = 256u;
+        static constexpr uint32_t numIdsPerWorker = 4096u;
+
+        //! @return ids per second
+        template< typename T_IdFactory >
+        double run( )
+        {
+            ::pmacc::HostDeviceBuffer< uint64_t, 1 > hashBuf( numBlocks * numWorkers );
+
+            auto const start = std::chrono::steady_clock::now( );
+            PMACC_KERNEL( KernelCreateIds< numWorkers, T_IdFactory >{ } )(
+                numBlocks,
+                numWorkers
+            )(
+                hashBuf.getDeviceBuffer( ).getDataBox( ),
+                numIdsPerWorker
+            );
+            double const seconds = std::chrono::duration< double >( std::chrono::steady_clock::now( ) - start ).count( );
+
+            return double( numBlocks ) * numWorkers * numIdsPerWorker / seconds;
+        }
+
+        void report( int const numThreads )
+        {
+            using IdProvider = ::pmacc::IdProvider< T_dim >;
+
+            // warm up, reserves the first ranges
+            run< typename IdProvider::GetNewId >( );
+
+            double const providerRate = run< typename IdProvider::GetNewId >( );
+            double const counterRate = run< SharedCounterId >( );
+
+            std::cout << "IdProvider: " << numThreads << " threads: "
+                      << providerRate << " ids/s, global counter: "
+                      << counterRate << " ids/s, speedup " << providerRate / counterRate
+                      << std::endl;
+        }
+
+        void operator()()
+        {
+            using IdProvider = ::pmacc::IdProvider< T_dim >;
+            IdProvider::init( );
+            typename IdProvider::State const state = IdProvider::getState( );
+
+#if defined( _OPENMP ) && !( BOOST_LANG_CUDA || BOOST_COMP_HIP )
+            int const maxThreads = omp_get_max_threads( );
+            for( int numThreads = 1; ; numThreads = std::min( 2 * numThreads, maxThreads ) )
+            {
+                omp_set_num_threads( numThreads );
+                report( numThreads );
+                if( numThreads == maxThreads )
+                    break;
+            }
+            omp_set_num_threads( maxThreads );
+#else
+            report( 0 );
+#endif
+
+            uint64_t const numIds = 2u * uint64_t( numBlocks ) * numWorkers * numIdsPerWorker;
+            BOOST_REQUIRE_GE( IdProvider::getState( ).nextId - state.nextId, numIds );
+            BOOST_REQUIRE( !IdProvider::isOverflown( ) );
+            IdProvider::setState( state );
+        }
+    };
+
+} // namespace particles
+} // namespace test
+} // namespace pmacc
+
+BOOST_AUTO_TEST_CASE( IdProviderBenchmark )
+{
+    using namespace pmacc::test::particles;
+    IdProviderBenchmark< TEST_DIM >()();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -34,3 +34,4 @@
 
 #include "IdProvider.hpp"
 #include "memory/SuperCell.hpp"
+#include "storage/Codecs.hpp"
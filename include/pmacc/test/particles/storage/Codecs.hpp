@@ -0,0 +1,163 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <pmacc/particles/storage/BFloat16.hpp>
+#include <pmacc/particles/storage/FixedPoint.hpp>
+#include <pmacc/particles/memory/dataTypes/PackedStaticArray.hpp>
+#include <pmacc/particles/memory/dataTypes/ConstantStaticArray.hpp>
+#include <pmacc/math/Vector.hpp>
+
+#include <boost/mpl/integral_c.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+
+namespace pmacc
+{
+namespace test
+{
+namespace particles
+{
+namespace storage
+{
+
+    //! value of a constant attribute
+    struct ConstantValue
+    {
+        HDINLINE float operator()() const
+        {
+            return 42.0f;
+        }
+    };
+
+    //! decode( encode( value ) ) of a scalar codec
+    template<
+        typename T_Codec,
+        typename T_Float
+    >
+    T_Float roundTrip( T_Float const value )
+    {
+        return T_Codec::template decode< T_Float >( T_Codec::encode( value ) );
+    }
+
+} // namespace storage
+} // namespace particles
+} // namespace test
+} // namespace pmacc
+
+BOOST_AUTO_TEST_CASE( fixedPointRoundTrip )
+{
+    using namespace pmacc::test::particles::storage;
+    using Codec = pmacc::particles::storage::FixedPoint< uint16_t >;
+    float const step = 1.0f / 65536.0f;
+
+    // multiples of the step are exact
+    for( uint32_t i = 0u; i < 65536u; i += 257u )
+        BOOST_CHECK_EQUAL( roundTrip< Codec >( float( i ) * step ), float( i ) * step );
+
+    // other values are rounded to the nearest multiple of the step
+    for( uint32_t i = 0u; i < 1000u; ++i )
+    {
+        float const value = float( i ) / 1000.0f;
+        BOOST_CHECK( std::abs( roundTrip< Codec >( value ) - value ) <= 0.5f * step );
+    }
+
+    // values outside of [0;1) are clamped
+    BOOST_CHECK_EQUAL( roundTrip< Codec >( -0.25f ), 0.0f );
+    BOOST_CHECK_EQUAL( roundTrip< Codec >( 1.0f ), 1.0f - step );
+    BOOST_CHECK_EQUAL( roundTrip< Codec >( 7.5f ), 1.0f - step );
+    BOOST_CHECK_EQUAL( roundTrip< Codec >( std::numeric_limits< float >::quiet_NaN() ), 0.0f );
+}
+
+BOOST_AUTO_TEST_CASE( bfloat16RoundTrip )
+{
+    using namespace pmacc::test::particles::storage;
+    using Codec = pmacc::particles::storage::BFloat16;
+
+    // values with an 8 bit significand are exact
+    for( float const value : { 0.0f, 1.0f, -2.5f, 0.375f, 65536.0f, -255.0f, std::ldexp( 1.5f, -100 ) } )
+        BOOST_CHECK_EQUAL( roundTrip< Codec >( value ), value );
+
+    // ties are rounded to even: 1 + 2^-8 lies between 1 and 1 + 2^-7
+    BOOST_CHECK_EQUAL( roundTrip< Codec >( 1.0f + std::ldexp( 1.0f, -8 ) ), 1.0f );
+    BOOST_CHECK_EQUAL(
+        roundTrip< Codec >( 1.0f + 3.0f * std::ldexp( 1.0f, -8 ) ),
+        1.0f + std::ldexp( 1.0f, -6 )
+    );
+
+    // relative error of rounding to nearest
+    for( int e = -60; e <= 60; e += 3 )
+        for( uint32_t i = 0u; i < 100u; ++i )
+        {
+            float const value = std::ldexp( 1.0f + float( i ) / 100.0f, e );
+            float const maxError = std::ldexp( value, -8 );
+            BOOST_CHECK( std::abs( roundTrip< Codec >( value ) - value ) <= maxError );
+            BOOST_CHECK( std::abs( roundTrip< Codec >( -value ) + value ) <= maxError );
+        }
+
+    float const inf = std::numeric_limits< float >::infinity();
+    BOOST_CHECK_EQUAL( roundTrip< Codec >( inf ), inf );
+    BOOST_CHECK_EQUAL( roundTrip< Codec >( -inf ), -inf );
+    BOOST_CHECK( std::isnan( roundTrip< Codec >( std::numeric_limits< float >::quiet_NaN() ) ) );
+}
+
+BOOST_AUTO_TEST_CASE( packedStaticArray )
+{
+    using Float3 = pmacc::math::Vector< float, 3 >;
+    pmacc::PackedStaticArray<
+        Float3,
+        pmacc::particles::storage::BFloat16,
+        boost::mpl::integral_c< uint32_t, 4u >
+    > array;
+    auto const & constArray = array;
+
+    array[ 1 ] = Float3( 1.0f, -2.5f, 0.375f );
+    Float3 const value = array[ 1 ];
+    BOOST_CHECK_EQUAL( value[ 0 ], 1.0f );
+    BOOST_CHECK_EQUAL( value[ 1 ], -2.5f );
+    BOOST_CHECK_EQUAL( value[ 2 ], 0.375f );
+
+    // components are read and written through the reference
+    array[ 1 ][ 2 ] = 4.0f;
+    array[ 1 ][ 0 ] += 1.0f;
+    BOOST_CHECK_EQUAL( float( array[ 1 ][ 0 ] ), 2.0f );
+    BOOST_CHECK_EQUAL( constArray[ 1 ][ 1 ], -2.5f );
+    BOOST_CHECK_EQUAL( constArray[ 1 ][ 2 ], 4.0f );
+}
+
+BOOST_AUTO_TEST_CASE( constantStaticArray )
+{
+    using namespace pmacc::test::particles::storage;
+    pmacc::ConstantStaticArray<
+        float,
+        ConstantValue,
+        boost::mpl::integral_c< uint32_t, 4u >
+    > array;
+    auto const & constArray = array;
+
+    BOOST_CHECK_EQUAL( float( array[ 3 ] ), 42.0f );
+    BOOST_CHECK_EQUAL( constArray[ 0 ], 42.0f );
+    BOOST_CHECK( ( pmacc::IsConstantReference< decltype( array[ 0 ] ) >::value ) );
+}
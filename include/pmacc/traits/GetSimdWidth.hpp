@@ -0,0 +1,96 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+
+
+namespace pmacc
+{
+namespace traits
+{
+    /** Get number of values of a type processed at once by one worker
+     *
+     * Accelerators with one worker per block process consecutive elements
+     * of a frame in SIMD lanes, all others use one element per worker.
+     *
+     * @tparam T_Type value type
+     * @tparam T_Acc the accelerator type
+     * @return @p ::value number of SIMD lanes
+     */
+    template<
+        typename T_Type,
+        typename T_Acc = cupla::AccThreadSeq
+    >
+    struct GetSimdWidth
+    {
+        static constexpr uint32_t value = 1u;
+    };
+
+namespace detail
+{
+    template< typename T_Type >
+    struct CpuSimdWidth
+    {
+        static constexpr uint32_t value =
+            PMACC_SIMD_ALIGNMENT > sizeof( T_Type ) ? PMACC_SIMD_ALIGNMENT / sizeof( T_Type ) : 1u;
+    };
+} // namespace detail
+
+#if( ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED == 1 )
+    template<
+        typename T_Type,
+        typename ... T_Args
+    >
+    struct GetSimdWidth<
+        T_Type,
+        alpaka::acc::AccCpuOmp2Blocks< T_Args... >
+    > : detail::CpuSimdWidth< T_Type >
+    {
+    };
+#endif
+#if( ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED == 1 )
+    template<
+        typename T_Type,
+        typename ... T_Args
+    >
+    struct GetSimdWidth<
+        T_Type,
+        alpaka::acc::AccCpuSerial< T_Args... >
+    > : detail::CpuSimdWidth< T_Type >
+    {
+    };
+#endif
+#if( ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED == 1 )
+    template<
+        typename T_Type,
+        typename ... T_Args
+    >
+    struct GetSimdWidth<
+        T_Type,
+        alpaka::acc::AccCpuTbbBlocks< T_Args... >
+    > : detail::CpuSimdWidth< T_Type >
+    {
+    };
+#endif
+} // namespace traits
+} // namespace pmacc
@@ -0,0 +1,63 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+#include <type_traits>
+
+
+namespace pmacc
+{
+namespace traits
+{
+    /** Check if device memory is directly accessible by the host
+     *
+     * True for all CPU accelerators, there device and host memory share the
+     * same address space and device buffers can be read and written by the
+     * host (e.g. by MPI) without copies.
+     *
+     * @tparam T_Acc the accelerator type
+     * @return @p ::value true if device memory is host accessible, else false
+     */
+    template< typename T_Acc = cupla::AccThreadSeq >
+    struct IsDeviceMemoryHostAccessible : std::true_type
+    {
+    };
+
+#if( ALPAKA_ACC_GPU_CUDA_ENABLED == 1 )
+    template< typename ... T_Args >
+    struct IsDeviceMemoryHostAccessible<
+        alpaka::acc::AccGpuCudaRt< T_Args... >
+    > : std::false_type
+    {
+    };
+#endif
+#if( ALPAKA_ACC_GPU_HIP_ENABLED == 1 )
+    template< typename ... T_Args >
+    struct IsDeviceMemoryHostAccessible<
+        alpaka::acc::AccGpuHipRt< T_Args... >
+    > : std::false_type
+    {
+    };
+#endif
+} // namespace traits
+} // namespace pmacc
@@ -0,0 +1,88 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/Environment.hpp"
+
+#include <redGrapes/resource/ioresource.hpp>
+namespace rg = redGrapes;
+
+#include <cstddef>
+#include <vector>
+
+namespace pmacc
+{
+
+    /** values which are computed by tasks
+     *
+     * The result is a resource: tasks which produce the values take
+     * `write()`, tasks which consume them (e.g. to write them into a file)
+     * take `read()` and are executed as soon as the values are available.
+     * Only get() waits for the producing tasks.
+     *
+     * Inside a task the values are accessed via `guard->data()` or `(*guard)[i]`.
+     *
+     * @tparam T value type
+     */
+    template< typename T >
+    class AsyncResult : public rg::IOResource< std::vector< T > >
+    {
+    public:
+
+        /**
+         * @param n number of values
+         */
+        explicit AsyncResult( std::size_t n = 1u ) :
+            rg::IOResource< std::vector< T > >( std::vector< T >( n ) ),
+            n( n )
+        {
+        }
+
+        //! number of values
+        std::size_t size() const
+        {
+            return n;
+        }
+
+        /** wait until all tasks which were writing the values are finished
+         *
+         * @param i index of the value
+         * @return copy of the value
+         */
+        T get( std::size_t i = 0u ) const
+        {
+            return Environment<>::task(
+                [ i ]( auto values )
+                {
+                    return ( *values )[ i ];
+                },
+                TaskProperties::Builder().label( "AsyncResult::get()" ),
+                this->read()
+            ).get();
+        }
+
+    private:
+
+        std::size_t n;
+    };
+
+} // namespace pmacc
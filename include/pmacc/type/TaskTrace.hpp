@@ -0,0 +1,370 @@
+/* Copyright 2020 Michael Sippel
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <pmacc/type/Scheduler.hpp>
+
+#include <redGrapes/property/trait.hpp>
+#include <redGrapes/resource/resource.hpp>
+namespace rg = redGrapes;
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pmacc
+{
+namespace trace
+{
+
+    /*! collects the resource accesses of task arguments
+     *
+     * Mimics the part of the redGrapes property builder interface which is
+     * used by the `BuildProperties` traits, so that the accesses of a task
+     * can be known before the task is handed over to the manager.
+     */
+    struct AccessCollector
+    {
+        std::vector< rg::ResourceAccess > accesses;
+
+        void add( rg::ResourceAccess const & access )
+        {
+            accesses.push_back( access );
+        }
+
+        template < typename T >
+        void add( T const & obj )
+        {
+            rg::trait::BuildProperties< T >::build( *this, obj );
+        }
+
+        template < typename T >
+        AccessCollector & label( T && )
+        {
+            return *this;
+        }
+
+        template < typename T >
+        AccessCollector & scheduling_tags( T && )
+        {
+            return *this;
+        }
+    };
+
+    /*! one executed task, all times in microseconds since trace start
+     */
+    struct TaskRecord
+    {
+        std::string label;
+        //! SchedulingTags value or -1 for the default scheduler
+        int tag = -1;
+        int thread = -1;
+        double enqueue = 0.0;
+        double start = 0.0;
+        double end = 0.0;
+        //! id of the task which emitted this task or -1
+        int64_t parent = -1;
+        //! ids of the tasks this task had to wait for
+        std::vector< uint64_t > predecessors;
+    };
+
+    /*! timeline of all tasks emitted through `Environment<>::task()`
+     *
+     * Dependency edges are derived from the resource accesses of the
+     * tasks which were not finished yet when a new task was enqueued,
+     * the same rule redGrapes uses to build its scheduling graph.
+     * The ready time of a task is the end time of its last predecessor.
+     *
+     * The result is written as Chrome-trace JSON, one file per rank,
+     * which can be opened in chrome://tracing or ui.perfetto.dev.
+     */
+    class TaskTrace
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /*! RAII helper which marks the begin and end of a task execution
+         *
+         * Does nothing for tasks which are not traced (id < 0).
+         */
+        struct Scope
+        {
+            Scope( int64_t id ) :
+                id( id )
+            {
+                if( id >= 0 )
+                {
+                    outer = current();
+                    current() = id;
+                    getInstance().start( id );
+                }
+            }
+
+            ~Scope()
+            {
+                if( id >= 0 )
+                {
+                    getInstance().finish( id );
+                    current() = outer;
+                }
+            }
+
+            int64_t id;
+            int64_t outer = -1;
+        };
+
+        static TaskTrace & getInstance()
+        {
+            static TaskTrace instance;
+            return instance;
+        }
+
+        /*! enable tracing
+         *
+         * @param prefix output file prefix, each rank writes `<prefix>_<rank>.json`
+         */
+        void enable( std::string const & prefix )
+        {
+            filePrefix = prefix;
+            t0 = Clock::now();
+            enabled = true;
+        }
+
+        bool isEnabled() const
+        {
+            return enabled;
+        }
+
+        /*! register a new task
+         *
+         * @return id which must be passed to start() and finish()
+         */
+        int64_t enqueue(
+            std::string const & label,
+            int tag,
+            std::vector< rg::ResourceAccess > accesses
+        )
+        {
+            double const now = timestamp();
+
+            std::lock_guard< std::mutex > lock( mutex );
+            uint64_t const id = records.size();
+
+            TaskRecord record;
+            record.label = label;
+            record.tag = tag;
+            record.enqueue = now;
+            record.parent = current();
+
+            /* a child task never waits for its (still running) parents */
+            for( auto const & p : pending )
+                if( ! isAncestor( p.first, record.parent ) && isSerial( p.second, accesses ) )
+                    record.predecessors.push_back( p.first );
+
+            records.push_back( std::move( record ) );
+            pending.emplace( id, std::move( accesses ) );
+
+            return id;
+        }
+
+        void start( uint64_t id )
+        {
+            double const now = timestamp();
+            int const thread = threadIndex();
+
+            std::lock_guard< std::mutex > lock( mutex );
+            records[ id ].start = now;
+            records[ id ].thread = thread;
+        }
+
+        void finish( uint64_t id )
+        {
+            double const now = timestamp();
+
+            std::lock_guard< std::mutex > lock( mutex );
+            records[ id ].end = now;
+            pending.erase( id );
+        }
+
+        /*! write the trace file of this rank
+         *
+         * Must be called after all tasks are finished.
+         */
+        void write( int rank )
+        {
+            if( ! enabled )
+                return;
+
+            std::string const fileName = filePrefix + "_" + std::to_string( rank ) + ".json";
+            std::ofstream file( fileName );
+            if( ! file )
+                throw std::runtime_error( "TaskTrace: failed to open " + fileName );
+
+            std::lock_guard< std::mutex > lock( mutex );
+
+            file << "{ \"displayTimeUnit\": \"ns\", \"traceEvents\": [\n";
+            file << fmt::format(
+                "{{ \"name\": \"process_name\", \"ph\": \"M\", \"pid\": {0}, "
+                "\"args\": {{ \"name\": \"rank {0}\" }} }}",
+                rank
+            );
+
+            uint64_t flowId = 0;
+            for( uint64_t id = 0; id < records.size(); ++id )
+            {
+                TaskRecord const & r = records[ id ];
+                // task was never executed
+                if( r.thread < 0 )
+                    continue;
+
+                double ready = r.enqueue;
+                for( uint64_t pred : r.predecessors )
+                    ready = std::max( ready, records[ pred ].end );
+
+                file << fmt::format(
+                    ",\n{{ \"name\": \"{}\", \"cat\": {}, \"ph\": \"X\", \"pid\": {}, \"tid\": {}, "
+                    "\"ts\": {:.3f}, \"dur\": {:.3f}, \"args\": {{ \"id\": {}, "
+                    "\"enqueue\": {:.3f}, \"ready\": {:.3f}, \"wait\": {:.3f}, \"predecessors\": {} }} }}",
+                    escape( r.label ),
+                    tagName( r.tag ),
+                    rank,
+                    r.thread,
+                    r.start,
+                    r.end - r.start,
+                    id,
+                    r.enqueue,
+                    ready,
+                    r.start - ready,
+                    r.predecessors.size()
+                );
+
+                for( uint64_t pred : r.predecessors )
+                {
+                    TaskRecord const & p = records[ pred ];
+                    if( p.thread < 0 )
+                        continue;
+
+                    file << fmt::format(
+                        ",\n{{ \"name\": \"dep\", \"cat\": \"dependency\", \"ph\": \"s\", \"id\": {0}, "
+                        "\"pid\": {1}, \"tid\": {2}, \"ts\": {3:.3f} }}"
+                        ",\n{{ \"name\": \"dep\", \"cat\": \"dependency\", \"ph\": \"f\", \"bp\": \"e\", \"id\": {0}, "
+                        "\"pid\": {1}, \"tid\": {4}, \"ts\": {5:.3f} }}",
+                        flowId++,
+                        rank,
+                        p.thread,
+                        p.end,
+                        r.thread,
+                        r.start
+                    );
+                }
+            }
+
+            file << "\n] }\n";
+        }
+
+    private:
+
+        TaskTrace() = default;
+
+        double timestamp() const
+        {
+            return std::chrono::duration< double, std::micro >( Clock::now() - t0 ).count();
+        }
+
+        //! id of the task executed by the calling thread, -1 outside of tasks
+        static int64_t & current()
+        {
+            thread_local int64_t id = -1;
+            return id;
+        }
+
+        bool isAncestor( uint64_t candidate, int64_t task ) const
+        {
+            for( ; task >= 0; task = records[ task ].parent )
+                if( uint64_t( task ) == candidate )
+                    return true;
+            return false;
+        }
+
+        //! small consecutive index for each thread which executes tasks
+        int threadIndex()
+        {
+            thread_local int index = nextThreadIndex++;
+            return index;
+        }
+
+        static bool isSerial(
+            std::vector< rg::ResourceAccess > const & a,
+            std::vector< rg::ResourceAccess > const & b
+        )
+        {
+            for( auto const & x : a )
+                for( auto const & y : b )
+                    if( rg::ResourceAccess::is_serial( x, y ) )
+                        return true;
+            return false;
+        }
+
+        static std::string tagName( int tag )
+        {
+            if( tag < 0 )
+                return "\"default\"";
+            return fmt::format( "{}", static_cast< SchedulingTags >( tag ) );
+        }
+
+        static std::string escape( std::string const & s )
+        {
+            std::string out;
+            out.reserve( s.size() );
+            for( char c : s )
+            {
+                if( c == '"' || c == '\\' )
+                    out += '\\';
+                out += c;
+            }
+            return out;
+        }
+
+        bool enabled = false;
+        std::string filePrefix;
+        Clock::time_point t0;
+
+        std::atomic< int > nextThreadIndex{ 0 };
+
+        std::mutex mutex;
+        std::vector< TaskRecord > records;
+        //! accesses of all enqueued but not yet finished tasks
+        std::map< uint64_t, std::vector< rg::ResourceAccess > > pending;
+    };
+
+} // namespace trace
+} // namespace pmacc
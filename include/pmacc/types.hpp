@@ -54,6 +54,7 @@
 #include "pmacc/attribute/FunctionSpecifier.hpp"
 #include "pmacc/attribute/Constexpr.hpp"
 #include "pmacc/attribute/Fallthrough.hpp"
+#include "pmacc/attribute/Simd.hpp"
 #include "pmacc/cuplaHelper/ValidateCall.hpp"
 #include "pmacc/memory/Align.hpp"
 #include "pmacc/memory/Delete.hpp"